@@ -23,6 +23,7 @@
 #include "util/random.hpp"
 #include "util/crypto.hpp"
 #include "data.hpp"
+#include "encoding/endian.hpp"
 
 namespace ndn {
 
@@ -34,7 +35,8 @@ static_assert(std::is_base_of<tlv::Error, Bead::Error>::value,
               "Bead::Error must inherit from tlv::Error");
 
 Bead::Bead()
-  : m_BeadLifetime(time::milliseconds::min())
+  : m_token(tlv::Token)
+  , m_BeadLifetime(time::milliseconds::min())
   , m_selectedDelegationIndex(INVALID_SELECTED_DELEGATION_INDEX)
 {
     setHops(0);
@@ -42,6 +44,7 @@ Bead::Bead()
 
 Bead::Bead(const Name& name)
   : m_name(name)
+  , m_token(tlv::Token)
   , m_BeadLifetime(time::milliseconds::min())
   , m_selectedDelegationIndex(INVALID_SELECTED_DELEGATION_INDEX)
 {
@@ -50,6 +53,7 @@ Bead::Bead(const Name& name)
 
 Bead::Bead(const Name& name, const time::milliseconds& BeadLifetime)
   : m_name(name)
+  , m_token(tlv::Token)
   , m_BeadLifetime(BeadLifetime)
   , m_selectedDelegationIndex(INVALID_SELECTED_DELEGATION_INDEX)
 {
@@ -57,10 +61,17 @@ Bead::Bead(const Name& name, const time::milliseconds& BeadLifetime)
 }
 
 Bead::Bead(const Block& wire)
+  : m_selectedDelegationIndex(INVALID_SELECTED_DELEGATION_INDEX)
 {
   wireDecode(wire);
 }
 
+Bead::Bead(const Block& wire, DecodeMode mode)
+  : m_selectedDelegationIndex(INVALID_SELECTED_DELEGATION_INDEX)
+{
+  wireDecode(wire, mode);
+}
+
 uint32_t
 Bead::getNonce() const
 {
@@ -93,10 +104,10 @@ Bead::setNonce(uint32_t nonce)
 std::string
 Bead::getToken() const
 {
-  if (m_token.value_size() == 0) {
-      const_cast<Bead*>(this)->setToken("");
-  }
-  return readString(m_token);
+  if (m_token.value_size() == 0)
+    return std::string();
+
+  return std::string(reinterpret_cast<const char*>(m_token.value()), m_token.value_size());
 }
 
 Bead&
@@ -110,20 +121,63 @@ Bead::setToken(std::string token)
 uint64_t
 Bead::getHops() const
 {
-  if (m_hops.value_size() == 0) {
-      const_cast<Bead*>(this)->setToken(0);
-  }
+  if (m_hops.value_size() == 0)
+    return 0;
+
   return readNonNegativeInteger(m_hops);
 }
 
 Bead&
 Bead::setHops(uint64_t hops)
 {
-  m_hops = makeNonNegativeIntegerBlock(tlv::BeadHops, hops);
-  m_wire.reset();
+  // BeadHops is always encoded as a fixed-width 8-octet NonNegativeInteger,
+  // so that forwarders can update it without re-encoding the whole Bead
+  uint64_t value = htobe64(hops);
+  if (m_wire.hasWire() && m_hops.value_size() == sizeof(value) && hasExclusiveWire()) {
+    std::memcpy(const_cast<uint8_t*>(m_hops.value()), &value, sizeof(value));
+  }
+  else {
+    m_hops = makeBinaryBlock(tlv::BeadHops,
+                             reinterpret_cast<const uint8_t*>(&value),
+                             sizeof(value));
+    m_wire.reset();
+  }
   return *this;
 }
 
+/** @return number of references to @p buffer held by @p block and its parsed sub-elements
+ */
+static long
+countBufferReferences(const Block& block, const Buffer* buffer)
+{
+  if (!block.hasWire() || block.getBuffer().get() != buffer)
+    return 0;
+
+  long nReferences = 1;
+  for (const Block& element : block.elements())
+    nReferences += countBufferReferences(element, buffer);
+  return nReferences;
+}
+
+bool
+Bead::hasExclusiveWire() const
+{
+  // References held by decoded Selectors are not counted, so a Bead with decoded Selectors
+  // is conservatively treated as shared and re-encoded
+  shared_ptr<const Buffer> buffer = m_wire.getBuffer();
+  long nOwnReferences = 1 + // buffer
+                        countBufferReferences(m_wire, buffer.get()) +
+                        countBufferReferences(m_nameWire, buffer.get()) +
+                        countBufferReferences(m_selectorsWire, buffer.get()) +
+                        countBufferReferences(m_hops, buffer.get()) +
+                        countBufferReferences(m_token, buffer.get()) +
+                        countBufferReferences(m_nonce, buffer.get()) +
+                        countBufferReferences(m_link, buffer.get());
+  if (m_name.hasWire())
+    nOwnReferences += countBufferReferences(m_name.wireEncode(), buffer.get());
+
+  return buffer.use_count() == nOwnReferences;
+}
 
 void
 Bead::refreshNonce()
@@ -142,25 +196,26 @@ Bead::refreshNonce()
 bool
 Bead::matchesName(const Name& name) const
 {
-  if (name.size() < m_name.size())
+  const Name& beadName = getName();
+  if (name.size() < beadName.size())
     return false;
 
-  if (!m_name.isPrefixOf(name))
+  if (!beadName.isPrefixOf(name))
     return false;
 
   if (getMinSuffixComponents() >= 0 &&
       // name must include implicit digest
-      !(name.size() - m_name.size() >= static_cast<size_t>(getMinSuffixComponents())))
+      !(name.size() - beadName.size() >= static_cast<size_t>(getMinSuffixComponents())))
     return false;
 
   if (getMaxSuffixComponents() >= 0 &&
       // name must include implicit digest
-      !(name.size() - m_name.size() <= static_cast<size_t>(getMaxSuffixComponents())))
+      !(name.size() - beadName.size() <= static_cast<size_t>(getMaxSuffixComponents())))
     return false;
 
   if (!getExclude().empty() &&
-      name.size() > m_name.size() &&
-      getExclude().isExcluded(name[m_name.size()]))
+      name.size() > beadName.size() &&
+      getExclude().isExcluded(name[beadName.size()]))
     return false;
 
   return true;
@@ -169,7 +224,8 @@ Bead::matchesName(const Name& name) const
 bool
 Bead::matchesData(const Data& data) const
 {
-  size_t BeadNameLength = m_name.size();
+  const Name& beadName = getName();
+  size_t BeadNameLength = beadName.size();
   const Name& dataName = data.getName();
   size_t fullNameLength = dataName.size() + 1;
 
@@ -188,8 +244,8 @@ Bead::matchesData(const Data& data) const
 
   // check prefix
   if (BeadNameLength == fullNameLength) {
-    if (m_name.get(-1).isImplicitSha256Digest()) {
-      if (m_name != data.getFullName())
+    if (beadName.get(-1).isImplicitSha256Digest()) {
+      if (beadName != data.getFullName())
         return false;
     }
     else {
@@ -200,7 +256,7 @@ Bead::matchesData(const Data& data) const
   }
   else {
     // Bead Name is a strict prefix of Data full Name
-    if (!m_name.isPrefixOf(dataName))
+    if (!beadName.isPrefixOf(dataName))
       return false;
   }
 
@@ -298,13 +354,20 @@ Bead::wireEncode(EncodingImpl<TAG>& encoder) const
   totalLength += encoder.prependBlock(m_hops);
 
   // Selectors
-  if (hasSelectors())
+  if (m_selectorsWire.hasWire())
+    {
+      totalLength += encoder.prependBlock(m_selectorsWire);
+    }
+  else if (hasSelectors())
     {
       totalLength += getSelectors().wireEncode(encoder);
     }
 
   // Name
-  totalLength += getName().wireEncode(encoder);
+  if (m_nameWire.hasWire())
+    totalLength += encoder.prependBlock(m_nameWire);
+  else
+    totalLength += getName().wireEncode(encoder);
 
   totalLength += encoder.prependVarNumber(totalLength);
   totalLength += encoder.prependVarNumber(tlv::Bead);
@@ -330,13 +393,13 @@ Bead::wireEncode() const
   wireEncode(buffer);
 
   // to ensure that Nonce block points to the right memory location
-  const_cast<Bead*>(this)->wireDecode(buffer.block());
+  const_cast<Bead*>(this)->wireDecode(buffer.block(), DECODE_LAZY);
 
   return m_wire;
 }
 
 void
-Bead::wireDecode(const Block& wire)
+Bead::wireDecode(const Block& wire, DecodeMode mode)
 {
   m_wire = wire;
   m_wire.parse();
@@ -344,6 +407,8 @@ Bead::wireDecode(const Block& wire)
   // Bead ::= Bead-TYPE TLV-LENGTH
   //                Name
   //                Selectors?
+  //                BeadHops
+  //                Token
   //                Nonce
   //                BeadLifetime?
   //                Link?
@@ -352,59 +417,96 @@ Bead::wireDecode(const Block& wire)
   if (m_wire.type() != tlv::Bead)
     BOOST_THROW_EXCEPTION(Error("Unexpected TLV number when decoding Bead"));
 
-  // Name
-  m_name.wireDecode(m_wire.get(tlv::Name));
-
-  // Selectors
-  Block::element_const_iterator val = m_wire.find(tlv::Selectors);
-  if (val != m_wire.elements_end())
-    {
-      m_selectors.wireDecode(*val);
-    }
-  else
-    m_selectors = Selectors();
-
-  // Hop count
-  m_hops = m_wire.get(tlv::BeadHops);
-
-  // Deletion token
-  m_token = m_wire.get(tlv::Token);
-
-  // Nonce
-  m_nonce = m_wire.get(tlv::Nonce);
-
-  // BeadLifetime
-  val = m_wire.find(tlv::BeadLifetime);
-  if (val != m_wire.elements_end())
-    {
+  // locate all top-level elements in a single pass; Name and Selectors are recorded
+  // and decoded by decodeName() and decodeSelectors()
+  m_nameWire.reset();
+  m_selectorsWire.reset();
+  m_hops.reset();
+  m_token.reset();
+  m_nonce.reset();
+  m_link.reset();
+  m_selectedDelegationIndex = INVALID_SELECTED_DELEGATION_INDEX;
+  m_BeadLifetime = DEFAULT_Bead_LIFETIME;
+
+  Block::element_const_iterator selectedDelegation = m_wire.elements_end();
+  for (Block::element_const_iterator val = m_wire.elements_begin();
+       val != m_wire.elements_end(); ++val) {
+    switch (val->type()) {
+    case tlv::Name:
+      m_nameWire = *val;
+      break;
+    case tlv::Selectors:
+      m_selectorsWire = *val;
+      break;
+    case tlv::BeadHops:
+      m_hops = *val;
+      break;
+    case tlv::Token:
+      m_token = *val;
+      break;
+    case tlv::Nonce:
+      m_nonce = *val;
+      break;
+    case tlv::BeadLifetime:
       m_BeadLifetime = time::milliseconds(readNonNegativeInteger(*val));
+      break;
+    case tlv::Data:
+      m_link = *val;
+      break;
+    case tlv::SelectedDelegation:
+      selectedDelegation = val;
+      break;
+    default:
+      break;
     }
-  else
-    {
-      m_BeadLifetime = DEFAULT_Bead_LIFETIME;
-    }
+  }
 
-  // Link object
-  val = m_wire.find(tlv::Data);
-  if (val != m_wire.elements_end())
-    {
-      m_link = (*val);
-    }
+  if (!m_nameWire.hasWire())
+    BOOST_THROW_EXCEPTION(Error("Name element is missing when decoding Bead"));
+  if (!m_hops.hasWire())
+    BOOST_THROW_EXCEPTION(Error("BeadHops element is missing when decoding Bead"));
+  if (!m_token.hasWire())
+    BOOST_THROW_EXCEPTION(Error("Token element is missing when decoding Bead"));
+  if (!m_nonce.hasWire())
+    BOOST_THROW_EXCEPTION(Error("Nonce element is missing when decoding Bead"));
+
+  // Selectors
+  if (!m_selectorsWire.hasWire())
+    m_selectors = Selectors();
 
   // SelectedDelegation
-  val = m_wire.find(tlv::SelectedDelegation);
-  if (val != m_wire.elements_end()) {
+  if (selectedDelegation != m_wire.elements_end()) {
     if (!this->hasLink()) {
       BOOST_THROW_EXCEPTION(Error("Bead contains selectedDelegation, but no LINK object"));
     }
-    uint64_t selectedDelegation = readNonNegativeInteger(*val);
-    if (selectedDelegation < uint64_t(Link::countDelegationsFromWire(m_link))) {
-      m_selectedDelegationIndex = static_cast<size_t>(selectedDelegation);
+    uint64_t selectedDelegationIndex = readNonNegativeInteger(*selectedDelegation);
+    if (selectedDelegationIndex < uint64_t(Link::countDelegationsFromWire(m_link))) {
+      m_selectedDelegationIndex = static_cast<size_t>(selectedDelegationIndex);
     }
     else {
       BOOST_THROW_EXCEPTION(Error("Invalid selected delegation index when decoding Bead"));
     }
   }
+
+  if (mode == DECODE_EAGER) {
+    decodeName();
+    if (m_selectorsWire.hasWire())
+      decodeSelectors();
+  }
+}
+
+void
+Bead::decodeName() const
+{
+  m_name.wireDecode(m_nameWire);
+  m_nameWire.reset();
+}
+
+void
+Bead::decodeSelectors() const
+{
+  m_selectors.wireDecode(m_selectorsWire);
+  m_selectorsWire.reset();
 }
 
 bool
@@ -84,6 +84,25 @@ public:
   explicit
   Bead(const Block& wire);
 
+  /** @brief Decoding mode
+   */
+  enum DecodeMode {
+    /** @brief decode all elements when the Bead is decoded
+     */
+    DECODE_EAGER,
+    /** @brief decode Name and Selectors on first access
+     *
+     *  Only the top-level elements are located when the Bead is decoded, which is all a
+     *  forwarder needs to read the hop count and token.  A malformed Name or Selectors
+     *  element is reported by the first accessor that needs it.
+     */
+    DECODE_LAZY
+  };
+
+  /** @brief Create from wire encoding using the specified decoding mode
+   */
+  Bead(const Block& wire, DecodeMode mode);
+
   /**
    * @brief Fast encoding or block size estimation
    */
@@ -101,7 +120,7 @@ public:
    * @brief Decode from the wire format
    */
   void
-  wireDecode(const Block& wire);
+  wireDecode(const Block& wire, DecodeMode mode = DECODE_EAGER);
 
   /**
    * @brief Check if already has wire
@@ -215,6 +234,8 @@ public: // Name and guiders
   const Name&
   getName() const
   {
+    if (m_nameWire.hasWire())
+      decodeName();
     return m_name;
   }
 
@@ -222,19 +243,48 @@ public: // Name and guiders
   setName(const Name& name)
   {
     m_name = name;
+    m_nameWire.reset();
     m_wire.reset();
     return *this;
   }
 
+  /** @brief Get Bead's token
+   *
+   *  If token was not set, an empty string is returned.
+   */
   std::string
   getToken() const;
 
+  /** @brief Get a non-owning view of Bead's token
+   *
+   *  The returned Token block refers to the Bead's own storage, so token octets can be
+   *  accessed via value() and value_size() without copying.  If token was not set, the block
+   *  has an empty value.  The reference is valid until the token is changed or the Bead is
+   *  destroyed.
+   */
+  const Block&
+  getTokenView() const
+  {
+    return m_token;
+  }
+
   Bead&
   setToken(std::string token);
 
+  /** @brief Get Bead's hop count
+   *
+   *  If hop count was not set, zero is returned.
+   */
   uint64_t
   getHops() const;
 
+  /** @brief Set Bead's hop count
+   *
+   *  If wire format already exists, contains a fixed-width hop count (as encoded by this
+   *  library), and is not shared with a copy of this Bead or any other Block, this call simply
+   *  replaces the hop count in the existing wire format, without resetting and recreating it.
+   *  Otherwise the Bead is re-encoded, so that other holders of the old wire are not affected.
+   */
   Bead&
   setHops(uint64_t hops);
 
@@ -333,12 +383,14 @@ public: // Selectors
   bool
   hasSelectors() const
   {
-    return !m_selectors.empty();
+    return !getSelectors().empty();
   }
 
   const Selectors&
   getSelectors() const
   {
+    if (m_selectorsWire.hasWire())
+      decodeSelectors();
     return m_selectors;
   }
 
@@ -346,6 +398,7 @@ public: // Selectors
   setSelectors(const Selectors& selectors)
   {
     m_selectors = selectors;
+    m_selectorsWire.reset();
     m_wire.reset();
     return *this;
   }
@@ -353,13 +406,13 @@ public: // Selectors
   int
   getMinSuffixComponents() const
   {
-    return m_selectors.getMinSuffixComponents();
+    return getSelectors().getMinSuffixComponents();
   }
 
   Bead&
   setMinSuffixComponents(int minSuffixComponents)
   {
-    m_selectors.setMinSuffixComponents(minSuffixComponents);
+    mutableSelectors().setMinSuffixComponents(minSuffixComponents);
     m_wire.reset();
     return *this;
   }
@@ -367,13 +420,13 @@ public: // Selectors
   int
   getMaxSuffixComponents() const
   {
-    return m_selectors.getMaxSuffixComponents();
+    return getSelectors().getMaxSuffixComponents();
   }
 
   Bead&
   setMaxSuffixComponents(int maxSuffixComponents)
   {
-    m_selectors.setMaxSuffixComponents(maxSuffixComponents);
+    mutableSelectors().setMaxSuffixComponents(maxSuffixComponents);
     m_wire.reset();
     return *this;
   }
@@ -381,13 +434,13 @@ public: // Selectors
   const KeyLocator&
   getPublisherPublicKeyLocator() const
   {
-    return m_selectors.getPublisherPublicKeyLocator();
+    return getSelectors().getPublisherPublicKeyLocator();
   }
 
   Bead&
   setPublisherPublicKeyLocator(const KeyLocator& keyLocator)
   {
-    m_selectors.setPublisherPublicKeyLocator(keyLocator);
+    mutableSelectors().setPublisherPublicKeyLocator(keyLocator);
     m_wire.reset();
     return *this;
   }
@@ -395,13 +448,13 @@ public: // Selectors
   const Exclude&
   getExclude() const
   {
-    return m_selectors.getExclude();
+    return getSelectors().getExclude();
   }
 
   Bead&
   setExclude(const Exclude& exclude)
   {
-    m_selectors.setExclude(exclude);
+    mutableSelectors().setExclude(exclude);
     m_wire.reset();
     return *this;
   }
@@ -409,13 +462,13 @@ public: // Selectors
   int
   getChildSelector() const
   {
-    return m_selectors.getChildSelector();
+    return getSelectors().getChildSelector();
   }
 
   Bead&
   setChildSelector(int childSelector)
   {
-    m_selectors.setChildSelector(childSelector);
+    mutableSelectors().setChildSelector(childSelector);
     m_wire.reset();
     return *this;
   }
@@ -423,13 +476,13 @@ public: // Selectors
   int
   getMustBeFresh() const
   {
-    return m_selectors.getMustBeFresh();
+    return getSelectors().getMustBeFresh();
   }
 
   Bead&
   setMustBeFresh(bool mustBeFresh)
   {
-    m_selectors.setMustBeFresh(mustBeFresh);
+    mutableSelectors().setMustBeFresh(mustBeFresh);
     m_wire.reset();
     return *this;
   }
@@ -448,8 +501,34 @@ public: // EqualityComparable concept
   }
 
 private:
-  Name m_name;
-  Selectors m_selectors;
+  /** @brief decode Name from the wire encoding recorded by a lazy decode
+   */
+  void
+  decodeName() const;
+
+  /** @brief decode Selectors from the wire encoding recorded by a lazy decode
+   */
+  void
+  decodeSelectors() const;
+
+  /** @brief check whether all references to the wire buffer are held by this Bead
+   */
+  bool
+  hasExclusiveWire() const;
+
+  Selectors&
+  mutableSelectors()
+  {
+    if (m_selectorsWire.hasWire())
+      decodeSelectors();
+    return m_selectors;
+  }
+
+private:
+  mutable Name m_name;
+  mutable Block m_nameWire; ///< Name element that has not been decoded yet
+  mutable Selectors m_selectors;
+  mutable Block m_selectorsWire; ///< Selectors element that has not been decoded yet
   mutable Block m_nonce;
   mutable Block m_token;
   mutable Block m_hops;
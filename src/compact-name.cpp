@@ -0,0 +1,243 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "compact-name.hpp"
+
+#include "encoding/block-helpers.hpp"
+#include "encoding/encoding-buffer.hpp"
+
+#include <cstring>
+
+namespace ndn {
+
+BOOST_CONCEPT_ASSERT((boost::EqualityComparable<CompactName>));
+static_assert(std::is_base_of<Name::Error, CompactName::Error>::value,
+              "CompactName::Error must inherit from Name::Error");
+
+static const Block&
+getEmptyNameWire()
+{
+  static const Block wire = makeEmptyBlock(tlv::Name);
+  return wire;
+}
+
+CompactName::CompactName()
+  : m_wire(getEmptyNameWire())
+  , m_size(0)
+  , m_offsets()
+{
+}
+
+CompactName::CompactName(const Block& wire)
+  : m_size(0)
+  , m_offsets()
+{
+  wireDecode(wire);
+}
+
+CompactName::CompactName(const Name& name)
+  : m_size(0)
+  , m_offsets()
+{
+  wireDecode(name.wireEncode());
+}
+
+CompactName::CompactName(const char* uri)
+  : m_size(0)
+  , m_offsets()
+{
+  wireDecode(Name(uri).wireEncode());
+}
+
+void
+CompactName::wireDecode(const Block& wire)
+{
+  if (wire.type() != tlv::Name)
+    BOOST_THROW_EXCEPTION(tlv::Error("Unexpected TLV type when decoding Name"));
+
+  if (!wire.hasWire()) {
+    Block encoded = wire;
+    encoded.encode();
+    return wireDecode(encoded);
+  }
+
+  if (wire.value_size() > std::numeric_limits<uint16_t>::max())
+    BOOST_THROW_EXCEPTION(Error("Name is too long to be stored in CompactName"));
+
+  // keep the wire only, without the sub-elements of a parsed Block
+  m_wire = Block(wire.getBuffer(), wire.type(), wire.begin(), wire.end(),
+                 wire.value_begin(), wire.value_end());
+  m_size = 0;
+  m_offsets[0] = 0;
+  m_moreOffsets.clear();
+
+  const uint8_t* valueBegin = m_wire.value();
+  const uint8_t* valueEnd = valueBegin + m_wire.value_size();
+  const uint8_t* end = tlv::splitElements(valueBegin, valueEnd,
+    [this, valueBegin] (uint32_t, const uint8_t*, const uint8_t*, const uint8_t* elementEnd) {
+      pushOffset(elementEnd - valueBegin);
+    });
+
+  if (end != valueEnd)
+    BOOST_THROW_EXCEPTION(tlv::Error("Name TLV-VALUE is not a sequence of complete TLV elements"));
+}
+
+void
+CompactName::pushOffset(size_t offset)
+{
+  ++m_size;
+  if (m_size <= INLINE_CAPACITY)
+    m_offsets[m_size] = static_cast<uint16_t>(offset);
+  else
+    m_moreOffsets.push_back(static_cast<uint16_t>(offset));
+}
+
+Name
+CompactName::toName() const
+{
+  return Name(m_wire);
+}
+
+std::string
+CompactName::toUri() const
+{
+  if (empty())
+    return "/";
+
+  size_t maxSize = 0;
+  for (const Component& component : *this)
+    maxSize += 1 + component.getMaxUriSize();
+
+  std::string uri(maxSize, '\0');
+  char* out = &uri[0];
+  for (const Component& component : *this) {
+    *out++ = '/';
+    out += component.toUri(out);
+  }
+  uri.resize(out - &uri[0]);
+  return uri;
+}
+
+CompactName::Component
+CompactName::at(ssize_t i) const
+{
+  if ((i >= 0 && static_cast<size_t>(i) >= m_size) ||
+      (i < 0  && static_cast<size_t>(-i) > m_size))
+    BOOST_THROW_EXCEPTION(Error("Requested component does not exist (out of bounds)"));
+
+  return get(i);
+}
+
+CompactName&
+CompactName::append(const Component& component)
+{
+  size_t valueSize = m_wire.value_size();
+
+  EncodingEstimator estimator;
+  size_t componentSize = component.wireEncode(estimator);
+  size_t newValueSize = valueSize + componentSize;
+  if (newValueSize > std::numeric_limits<uint16_t>::max())
+    BOOST_THROW_EXCEPTION(Error("Name is too long to be stored in CompactName"));
+
+  EncodingBuffer encoder(tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(newValueSize) +
+                         newValueSize, 0);
+  component.wireEncode(encoder);
+  encoder.prependByteArray(m_wire.value(), valueSize);
+  encoder.prependVarNumber(newValueSize);
+  encoder.prependVarNumber(tlv::Name);
+
+  m_wire = encoder.block();
+  pushOffset(newValueSize);
+  return *this;
+}
+
+bool
+CompactName::isPrefixOf(const CompactName& other) const
+{
+  if (m_size > other.m_size)
+    return false;
+
+  // the encodings of equal components are identical in the common case
+  size_t prefixSize = getOffset(m_size);
+  if (prefixSize == other.getOffset(m_size) &&
+      std::memcmp(m_wire.value(), other.m_wire.value(), prefixSize) == 0)
+    return true;
+
+  for (size_t i = 0; i < m_size; ++i) {
+    if (get(i) != other.get(i))
+      return false;
+  }
+  return true;
+}
+
+int
+CompactName::compare(const CompactName& other) const
+{
+  size_t nComponents = std::min(m_size, other.m_size);
+  for (size_t i = 0; i < nComponents; ++i) {
+    int comparison = get(i).compare(other.get(i));
+    if (comparison != 0)
+      return comparison;
+  }
+
+  if (m_size < other.m_size)
+    return -1;
+  else if (m_size > other.m_size)
+    return 1;
+  else
+    return 0;
+}
+
+bool
+CompactName::operator==(const CompactName& other) const
+{
+  if (m_size != other.m_size)
+    return false;
+
+  return other.isPrefixOf(*this);
+}
+
+size_t
+CompactName::getHash() const
+{
+  size_t hash = 0;
+  for (size_t i = 0; i < m_size; ++i) {
+    hash = Name::extendHash(hash, get(i));
+  }
+  return hash;
+}
+
+std::ostream&
+operator<<(std::ostream& os, const CompactName& name)
+{
+  if (name.empty()) {
+    os << "/";
+  }
+  else {
+    for (const name::Component& component : name) {
+      os << "/";
+      component.toUri(os);
+    }
+  }
+  return os;
+}
+
+} // namespace ndn
@@ -0,0 +1,324 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_COMPACT_NAME_HPP
+#define NDN_COMPACT_NAME_HPP
+
+#include "name.hpp"
+
+#include <iterator>
+
+namespace ndn {
+
+/**
+ * @brief Compact storage of a name as one contiguous TLV wire buffer
+ *
+ * A Name keeps a Block for every component.  CompactName instead keeps only the Name TLV
+ * wire and a table of component offsets into it, stored inline for names of up to
+ * INLINE_CAPACITY components.  Copying a CompactName, accessing its components and encoding it
+ * do not allocate memory; components are returned by value as Blocks referring to the shared
+ * wire buffer.
+ *
+ * CompactName is meant for names that are mostly stored and compared, such as table keys.
+ * Appending a component re-encodes the whole name; use Name to build names.
+ */
+class CompactName
+{
+public:
+  /**
+   * @brief Error that can be thrown from CompactName
+   */
+  class Error : public Name::Error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : Name::Error(what)
+    {
+    }
+  };
+
+  typedef name::Component Component;
+
+  /**
+   * @brief Iterator over the components, each dereferenced by value
+   */
+  class const_iterator : public std::iterator<std::input_iterator_tag, const Component>
+  {
+  public:
+    const_iterator(const CompactName* name, size_t index)
+      : m_name(name)
+      , m_index(index)
+    {
+    }
+
+    const_iterator&
+    operator++()
+    {
+      ++m_index;
+      return *this;
+    }
+
+    const_iterator
+    operator++(int)
+    {
+      const_iterator i = *this;
+      ++m_index;
+      return i;
+    }
+
+    Component
+    operator*() const
+    {
+      return m_name->get(m_index);
+    }
+
+    bool
+    operator==(const const_iterator& rhs) const
+    {
+      return m_name == rhs.m_name && m_index == rhs.m_index;
+    }
+
+    bool
+    operator!=(const const_iterator& rhs) const
+    {
+      return !(*this == rhs);
+    }
+
+  private:
+    const CompactName* m_name;
+    size_t m_index;
+  };
+
+  /**
+   * @brief Number of components whose offsets are stored without allocating memory
+   */
+  static const size_t INLINE_CAPACITY = 8;
+
+  /**
+   * @brief Create an empty name
+   */
+  CompactName();
+
+  /**
+   * @brief Create a name from the Name TLV @p wire, sharing its buffer
+   * @throw tlv::Error @p wire is not a valid Name TLV
+   * @throw CompactName::Error TLV-VALUE of @p wire is longer than 65535 octets
+   */
+  explicit
+  CompactName(const Block& wire);
+
+  /**
+   * @brief Create a name with the components of @p name, sharing its wire encoding
+   * @note This constructor allows implicit conversion from Name.
+   */
+  CompactName(const Name& name);
+
+  /**
+   * @brief Create a name from an NDN URI
+   * @see Name(const char*)
+   */
+  explicit
+  CompactName(const char* uri);
+
+  /**
+   * @brief Decode the name from the Name TLV @p wire, sharing its buffer
+   * @throw tlv::Error @p wire is not a valid Name TLV
+   * @throw CompactName::Error TLV-VALUE of @p wire is longer than 65535 octets
+   */
+  void
+  wireDecode(const Block& wire);
+
+  /**
+   * @brief Get the Name TLV
+   *
+   * The returned Block is not parsed into sub-elements.
+   */
+  const Block&
+  wireEncode() const
+  {
+    return m_wire;
+  }
+
+  /**
+   * @brief Create a new Name with the components of this name
+   */
+  Name
+  toName() const;
+
+  std::string
+  toUri() const;
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief Get the component at the given index
+   *
+   * A negative index counts from the end, as in Name::get.  The index is not checked.
+   */
+  Component
+  get(ssize_t i) const
+  {
+    size_t index = i >= 0 ? static_cast<size_t>(i) : m_size + i;
+    Buffer::const_iterator valueBegin = m_wire.value_begin();
+    return Component(Block(m_wire.getBuffer(),
+                           valueBegin + getOffset(index), valueBegin + getOffset(index + 1)));
+  }
+
+  Component
+  operator[](ssize_t i) const
+  {
+    return get(i);
+  }
+
+  /**
+   * @brief Get the component at the given index
+   * @throw Name::Error the component does not exist
+   */
+  Component
+  at(ssize_t i) const;
+
+  /**
+   * @brief Append a component, re-encoding the name
+   */
+  CompactName&
+  append(const Component& component);
+
+  /**
+   * @brief Check if this name is a prefix of @p other
+   */
+  bool
+  isPrefixOf(const CompactName& other) const;
+
+  /**
+   * @brief Compare with @p other in NDN canonical order
+   * @return 0 if equal, a negative value if this name is less than @p other, otherwise a
+   *         positive value
+   */
+  int
+  compare(const CompactName& other) const;
+
+  /**
+   * @brief Get the hash value of the name
+   *
+   * The value equals Name::getHash() of a Name with the same components.
+   */
+  size_t
+  getHash() const;
+
+  bool
+  operator==(const CompactName& other) const;
+
+  bool
+  operator!=(const CompactName& other) const
+  {
+    return !(*this == other);
+  }
+
+  bool
+  operator<(const CompactName& other) const
+  {
+    return compare(other) < 0;
+  }
+
+  bool
+  operator<=(const CompactName& other) const
+  {
+    return compare(other) <= 0;
+  }
+
+  bool
+  operator>(const CompactName& other) const
+  {
+    return compare(other) > 0;
+  }
+
+  bool
+  operator>=(const CompactName& other) const
+  {
+    return compare(other) >= 0;
+  }
+
+  const_iterator
+  begin() const
+  {
+    return const_iterator(this, 0);
+  }
+
+  const_iterator
+  end() const
+  {
+    return const_iterator(this, m_size);
+  }
+
+private:
+  /** @brief get the offset of the i-th component within TLV-VALUE of the wire
+   *
+   *  The offset of component size() is the length of TLV-VALUE.
+   */
+  size_t
+  getOffset(size_t i) const
+  {
+    if (i <= INLINE_CAPACITY)
+      return m_offsets[i];
+    else
+      return m_moreOffsets[i - INLINE_CAPACITY - 1];
+  }
+
+  void
+  pushOffset(size_t offset);
+
+private:
+  Block m_wire;
+  size_t m_size;
+  uint16_t m_offsets[INLINE_CAPACITY + 1];
+  std::vector<uint16_t> m_moreOffsets;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const CompactName& name);
+
+} // namespace ndn
+
+namespace std {
+template<>
+struct hash<ndn::CompactName>
+{
+  size_t
+  operator()(const ndn::CompactName& name) const
+  {
+    return name.getHash();
+  }
+};
+
+} // namespace std
+
+#endif // NDN_COMPACT_NAME_HPP
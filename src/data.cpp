@@ -54,15 +54,10 @@ Data::Data(const Block& wire)
 std::string
 Data::getToken() const
 {
-  if (m_token.value_size() == 0) {
-      const_cast<Data*>(this)->setToken("");
-  }
-  return readString(m_token);
-  // if (m_token.value_size() > 0)
-  //   return *reinterpret_cast<std::string>(m_token.value());
-  // else {
-  //   return readString(m_token);
-  // }
+  if (m_token.value_size() == 0)
+    return std::string();
+
+  return std::string(reinterpret_cast<const char*>(m_token.value()), m_token.value_size());
 }
 
 Data&
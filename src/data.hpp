@@ -211,9 +211,24 @@ public:
   Data&
   setFinalBlockId(const name::Component& finalBlockId);
 
+  /** @brief Get Data's token
+   *
+   *  If token was not set, an empty string is returned.
+   */
   std::string
   getToken() const;
 
+  /** @brief Get a non-owning view of Data's token
+   *
+   *  Token octets can be accessed via value() and value_size() of the returned block without
+   *  copying.  If token was not set, the block has an empty value.
+   */
+  const Block&
+  getTokenView() const
+  {
+    return m_token;
+  }
+
   Data&
   setToken(std::string token);
 
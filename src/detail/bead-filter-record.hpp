@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_DETAIL_BEAD_FILTER_RECORD_HPP
+#define NDN_DETAIL_BEAD_FILTER_RECORD_HPP
+
+#include "../common.hpp"
+#include "../name.hpp"
+#include "../bead.hpp"
+
+namespace ndn {
+
+class BeadFilterRecord : noncopyable
+{
+public:
+  typedef function<void(const Name&, const shared_ptr<const Bead>&)> BeadCallback;
+
+  BeadFilterRecord(const Name& prefix, const BeadCallback& afterBead)
+    : m_prefix(prefix)
+    , m_afterBead(afterBead)
+  {
+  }
+
+  /**
+   * @brief invokes the BeadCallback
+   *
+   * The Bead is handed over as a shared pointer, so the callback can keep it without copying.
+   */
+  void
+  invokeBeadCallback(const shared_ptr<const Bead>& bead) const
+  {
+    m_afterBead(m_prefix, bead);
+  }
+
+  const Name&
+  getPrefix() const
+  {
+    return m_prefix;
+  }
+
+private:
+  Name m_prefix;
+  BeadCallback m_afterBead;
+};
+
+
+/**
+ * @brief Opaque class representing ID of the Bead filter
+ */
+class BeadFilterId;
+
+/**
+ * @brief Functor to match BeadFilterId
+ */
+class MatchBeadFilterId
+{
+public:
+  explicit
+  MatchBeadFilterId(const BeadFilterId* beadFilterId)
+    : m_id(beadFilterId)
+  {
+  }
+
+  bool
+  operator()(const shared_ptr<BeadFilterRecord>& beadFilter) const
+  {
+    return (reinterpret_cast<const BeadFilterId*>(beadFilter.get()) == m_id);
+  }
+private:
+  const BeadFilterId* m_id;
+};
+
+} // namespace ndn
+
+#endif // NDN_DETAIL_BEAD_FILTER_RECORD_HPP
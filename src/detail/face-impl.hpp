@@ -27,6 +27,9 @@
 
 #include "registered-prefix.hpp"
 #include "pending-interest.hpp"
+#include "pending-interest-table.hpp"
+#include "interest-filter-table.hpp"
+#include "bead-filter-table.hpp"
 #include "container-with-on-empty-signal.hpp"
 
 #include "../util/scheduler.hpp"
@@ -52,8 +55,6 @@ namespace ndn {
 class Face::Impl : noncopyable
 {
 public:
-  typedef ContainerWithOnEmptySignal<shared_ptr<PendingInterest>> PendingInterestTable;
-  typedef std::list<shared_ptr<InterestFilterRecord> > InterestFilterTable;
   typedef ContainerWithOnEmptySignal<shared_ptr<RegisteredPrefix>> RegisteredPrefixTable;
 
   class NfdFace : public ::nfd::LocalFace
@@ -93,16 +94,16 @@ public:
     }
 
     /**
-     * @brief Send Data towards application
+     * @brief Send Bead towards application
      */
     virtual void
     sendBead(const Bead& bead)
     {
       NS_LOG_DEBUG("<< Bead " << bead.getName());
-    //   shared_ptr<const Bead> beadPtr = bead.shared_from_this();
-    //   m_appFaceImpl.m_scheduler.scheduleEvent(time::seconds(0), [this, beadPtr] {
-    //       m_appFaceImpl.satisfyPendingInterests(*dataPtr);
-    //     });
+      shared_ptr<const Bead> beadPtr = bead.shared_from_this();
+      m_appFaceImpl.m_scheduler.scheduleEvent(time::seconds(0), [this, beadPtr] {
+          m_appFaceImpl.processBeadFilters(beadPtr);
+        });
     }
 
     /** \brief Close the face
@@ -127,6 +128,7 @@ public:
   Impl(Face& face)
     : m_face(face)
     , m_scheduler(m_face.getIoService())
+    , m_nCopiedPackets(0)
   {
     ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
     NS_ASSERT_MSG(node->GetObject<ns3::ndn::L3Protocol>() != 0,
@@ -144,26 +146,28 @@ public:
   void
   satisfyPendingInterests(const Data& data)
   {
-    for (auto entry = m_pendingInterestTable.begin(); entry != m_pendingInterestTable.end(); ) {
-      if ((*entry)->getInterest().matchesData(data)) {
-        shared_ptr<PendingInterest> matchedEntry = *entry;
+    for (auto entry : m_pendingInterestTable.findAllMatches(data)) {
+      shared_ptr<PendingInterest> matchedEntry = *entry;
 
-        entry = m_pendingInterestTable.erase(entry);
+      m_pendingInterestTable.erase(entry);
 
-        matchedEntry->invokeDataCallback(data);
-      }
-      else
-        ++entry;
+      matchedEntry->invokeDataCallback(data);
     }
   }
 
   void
   processInterestFilters(const Interest& interest)
   {
-    for (const auto& filter : m_interestFilterTable) {
-      if (filter->doesMatch(interest.getName())) {
-        filter->invokeInterestCallback(interest);
-      }
+    for (const auto& filter : m_interestFilterTable.findAllMatches(interest.getName())) {
+      filter->invokeInterestCallback(interest);
+    }
+  }
+
+  void
+  processBeadFilters(const shared_ptr<const Bead>& bead)
+  {
+    for (const auto& filter : m_beadFilterTable.findAllMatches(bead->getName())) {
+      filter->invokeBeadCallback(bead);
     }
   }
 
@@ -222,6 +226,24 @@ public:
       }
   }
 
+  void
+  asyncSetBeadFilter(const shared_ptr<BeadFilterRecord>& beadFilterRecord)
+  {
+    m_beadFilterTable.push_back(beadFilterRecord);
+  }
+
+  void
+  asyncUnsetBeadFilter(const BeadFilterId* beadFilterId)
+  {
+    BeadFilterTable::iterator i = std::find_if(m_beadFilterTable.begin(),
+                                               m_beadFilterTable.end(),
+                                               MatchBeadFilterId(beadFilterId));
+    if (i != m_beadFilterTable.end())
+      {
+        m_beadFilterTable.erase(i);
+      }
+  }
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -318,10 +340,14 @@ private:
 
   PendingInterestTable m_pendingInterestTable;
   InterestFilterTable m_interestFilterTable;
+  BeadFilterTable m_beadFilterTable;
   RegisteredPrefixTable m_registeredPrefixTable;
 
   shared_ptr<NfdFace> m_nfdFace;
 
+  /// number of packets copied on the put path because they were not owned by shared_ptr
+  uint64_t m_nCopiedPackets;
+
   friend class Face;
 };
 
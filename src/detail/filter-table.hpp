@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_DETAIL_FILTER_TABLE_HPP
+#define NDN_DETAIL_FILTER_TABLE_HPP
+
+#include "../common.hpp"
+#include "../name.hpp"
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+
+namespace ndn {
+
+/**
+ * @brief Describes how FilterTable reads the filter of a record
+ *
+ * The default handles records with a plain prefix filter, exposed as getPrefix().
+ * Specialize it for records whose filter may contain a regular expression.
+ */
+template<typename Record>
+struct FilterTableTraits
+{
+  static const Name&
+  getPrefix(const Record& record)
+  {
+    return record.getPrefix();
+  }
+
+  static bool
+  hasRegexFilter(const Record&)
+  {
+    return false;
+  }
+
+  static bool
+  doesMatchRegexFilter(const Record&, const Name&)
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Table of filter records, indexed by filter prefix
+ *
+ * Records are stored in registration order in a list.  Filters without a regular expression
+ * are indexed by their exact prefix, so that filters matching a packet name are found with
+ * one hash lookup per prefix of that name.  Filters with a regular expression cannot be
+ * matched by prefix alone and are kept in a separate list that is tested sequentially.
+ *
+ * @tparam Record type of the filter records, e.g. InterestFilterRecord or BeadFilterRecord
+ */
+template<typename Record>
+class FilterTable : noncopyable
+{
+public:
+  typedef shared_ptr<Record> value_type;
+  typedef std::list<value_type> Base;
+  typedef typename Base::iterator iterator;
+
+  FilterTable()
+    : m_nextSeqNo(0)
+  {
+  }
+
+  iterator
+  begin()
+  {
+    return m_container.begin();
+  }
+
+  iterator
+  end()
+  {
+    return m_container.end();
+  }
+
+  size_t
+  size() const
+  {
+    return m_container.size();
+  }
+
+  bool
+  empty() const
+  {
+    return m_container.empty();
+  }
+
+  void
+  push_back(const value_type& value)
+  {
+    iterator item = m_container.insert(end(), value);
+    IndexEntry entry{m_nextSeqNo++, item};
+    if (Traits::hasRegexFilter(*value)) {
+      m_regexFilters.push_back(entry);
+    }
+    else {
+      m_index[Traits::getPrefix(*value)].push_back(entry);
+    }
+  }
+
+  iterator
+  erase(iterator item)
+  {
+    this->removeFromIndex(item);
+    return m_container.erase(item);
+  }
+
+  void
+  remove(const value_type& value)
+  {
+    for (iterator item = begin(); item != end(); ) {
+      if (*item == value) {
+        item = this->erase(item);
+      }
+      else {
+        ++item;
+      }
+    }
+  }
+
+  void
+  clear()
+  {
+    m_index.clear();
+    m_regexFilters.clear();
+    m_container.clear();
+  }
+
+  /**
+   * @brief Find all filters that match the packet name @p name
+   * @return matching records, in the order they were added to the table
+   */
+  std::vector<value_type>
+  findAllMatches(const Name& name) const
+  {
+    std::vector<IndexEntry> candidates;
+
+    if (!m_index.empty()) {
+      Name prefix;
+      for (size_t i = 0; i <= name.size(); ++i) {
+        typename Index::const_iterator bucket = m_index.find(prefix);
+        if (bucket != m_index.end()) {
+          candidates.insert(candidates.end(), bucket->second.begin(), bucket->second.end());
+        }
+        if (i < name.size())
+          prefix.append(name[i]);
+      }
+    }
+
+    for (const IndexEntry& entry : m_regexFilters) {
+      if (Traits::doesMatchRegexFilter(**entry.item, name)) {
+        candidates.push_back(entry);
+      }
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [] (const IndexEntry& a, const IndexEntry& b) { return a.seqNo < b.seqNo; });
+
+    std::vector<value_type> matches;
+    matches.reserve(candidates.size());
+    for (const IndexEntry& entry : candidates) {
+      matches.push_back(*entry.item);
+    }
+    return matches;
+  }
+
+private:
+  typedef FilterTableTraits<Record> Traits;
+
+  struct IndexEntry
+  {
+    uint64_t seqNo;
+    iterator item;
+  };
+
+  typedef std::unordered_map<Name, std::vector<IndexEntry>> Index;
+
+  void
+  removeFromIndex(iterator item)
+  {
+    auto isItem = [item] (const IndexEntry& e) { return e.item == item; };
+
+    if (Traits::hasRegexFilter(**item)) {
+      m_regexFilters.erase(std::remove_if(m_regexFilters.begin(), m_regexFilters.end(), isItem),
+                           m_regexFilters.end());
+      return;
+    }
+
+    typename Index::iterator bucket = m_index.find(Traits::getPrefix(**item));
+    if (bucket == m_index.end())
+      return;
+
+    std::vector<IndexEntry>& entries = bucket->second;
+    entries.erase(std::remove_if(entries.begin(), entries.end(), isItem), entries.end());
+    if (entries.empty())
+      m_index.erase(bucket);
+  }
+
+private:
+  Base m_container;
+  Index m_index;
+  std::vector<IndexEntry> m_regexFilters;
+  uint64_t m_nextSeqNo;
+};
+
+} // namespace ndn
+
+#endif // NDN_DETAIL_FILTER_TABLE_HPP
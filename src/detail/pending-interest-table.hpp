@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_DETAIL_PENDING_INTEREST_TABLE_HPP
+#define NDN_DETAIL_PENDING_INTEREST_TABLE_HPP
+
+#include "../common.hpp"
+#include "../util/signal.hpp"
+#include "pending-interest.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace ndn {
+
+/**
+ * @brief Table of pending Interests, indexed by Interest name
+ *
+ * Entries are stored in insertion order in a list, so that iterators remain valid until the
+ * entry is erased.  In addition, every entry is indexed by the exact name of its Interest,
+ * which allows finding entries that can be satisfied by a Data packet with one hash lookup
+ * per prefix of the Data name, instead of testing every entry in the table.
+ *
+ * The interface follows ContainerWithOnEmptySignal.
+ */
+class PendingInterestTable : noncopyable
+{
+public:
+  typedef shared_ptr<PendingInterest> value_type;
+  typedef std::list<value_type> Base;
+  typedef Base::iterator iterator;
+
+  PendingInterestTable()
+    : m_nextSeqNo(0)
+    , m_nDigestNames(0)
+  {
+  }
+
+  iterator
+  begin()
+  {
+    return m_container.begin();
+  }
+
+  iterator
+  end()
+  {
+    return m_container.end();
+  }
+
+  size_t
+  size()
+  {
+    return m_container.size();
+  }
+
+  bool
+  empty()
+  {
+    return m_container.empty();
+  }
+
+  iterator
+  erase(iterator item)
+  {
+    this->removeFromIndex(item);
+    iterator next = m_container.erase(item);
+    if (empty()) {
+      this->onEmpty();
+    }
+    return next;
+  }
+
+  void
+  clear()
+  {
+    m_index.clear();
+    m_nDigestNames = 0;
+    m_container.clear();
+    this->onEmpty();
+  }
+
+  std::pair<iterator, bool>
+  insert(const value_type& value)
+  {
+    iterator item = m_container.insert(end(), value);
+    this->addToIndex(item);
+    return {item, true};
+  }
+
+  template<class Predicate>
+  void remove_if(Predicate p)
+  {
+    for (iterator item = begin(); item != end(); ) {
+      if (p(*item)) {
+        this->removeFromIndex(item);
+        item = m_container.erase(item);
+      }
+      else {
+        ++item;
+      }
+    }
+    if (empty()) {
+      this->onEmpty();
+    }
+  }
+
+  /**
+   * @brief Find all entries that can be satisfied by @p data
+   *
+   * Only entries whose Interest name is a prefix of the Data name, or equals the Data full
+   * name, are tested with Interest::matchesData, so the cost of this operation depends on
+   * the number of components in the Data name rather than on the size of the table.
+   *
+   * @return iterators to the matching entries, in the order the entries were inserted
+   */
+  std::vector<iterator>
+  findAllMatches(const Data& data)
+  {
+    if (m_index.empty())
+      return {};
+
+    std::vector<IndexEntry> candidates;
+
+    const Name& dataName = data.getName();
+    Name prefix;
+    for (size_t i = 0; i <= dataName.size(); ++i) {
+      this->collectCandidates(prefix, candidates);
+      if (i < dataName.size())
+        prefix.append(dataName[i]);
+    }
+
+    // Interest name can only end with the implicit digest if it equals the full Data name,
+    // which is expensive to compute, so do it only if such entries exist
+    if (m_nDigestNames > 0) {
+      this->collectCandidates(data.getFullName(), candidates);
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [] (const IndexEntry& a, const IndexEntry& b) { return a.seqNo < b.seqNo; });
+
+    std::vector<iterator> matches;
+    for (const IndexEntry& candidate : candidates) {
+      if ((*candidate.item)->getInterest().matchesData(data)) {
+        matches.push_back(candidate.item);
+      }
+    }
+    return matches;
+  }
+
+private:
+  struct IndexEntry
+  {
+    uint64_t seqNo;
+    iterator item;
+  };
+
+  typedef std::unordered_map<Name, std::vector<IndexEntry>> Index;
+
+  static bool
+  endsWithDigest(const Name& name)
+  {
+    return !name.empty() && name.get(-1).isImplicitSha256Digest();
+  }
+
+  void
+  addToIndex(iterator item)
+  {
+    const Name& name = (*item)->getInterest().getName();
+    m_index[name].push_back({m_nextSeqNo++, item});
+    if (endsWithDigest(name))
+      ++m_nDigestNames;
+  }
+
+  void
+  removeFromIndex(iterator item)
+  {
+    const Name& name = (*item)->getInterest().getName();
+    Index::iterator bucket = m_index.find(name);
+    if (bucket == m_index.end())
+      return;
+
+    std::vector<IndexEntry>& entries = bucket->second;
+    auto entry = std::find_if(entries.begin(), entries.end(),
+                              [item] (const IndexEntry& e) { return e.item == item; });
+    if (entry == entries.end())
+      return;
+
+    entries.erase(entry);
+    if (entries.empty())
+      m_index.erase(bucket);
+    if (endsWithDigest(name))
+      --m_nDigestNames;
+  }
+
+  void
+  collectCandidates(const Name& name, std::vector<IndexEntry>& candidates) const
+  {
+    Index::const_iterator bucket = m_index.find(name);
+    if (bucket != m_index.end()) {
+      candidates.insert(candidates.end(), bucket->second.begin(), bucket->second.end());
+    }
+  }
+
+public:
+  Base m_container;
+
+  /**
+   * @brief Signal to be fired when container becomes empty
+   */
+  util::Signal<PendingInterestTable> onEmpty;
+
+private:
+  Index m_index;
+  uint64_t m_nextSeqNo;
+  size_t m_nDigestNames;
+};
+
+} // namespace ndn
+
+#endif // NDN_DETAIL_PENDING_INTEREST_TABLE_HPP
@@ -26,7 +26,6 @@
 
 #include "tlv.hpp"
 #include "encoding-buffer.hpp"
-#include "buffer-stream.hpp"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/asio/buffer.hpp>
@@ -324,31 +323,58 @@ Block::parse() const
   if (!m_subBlocks.empty() || value_size() == 0)
     return;
 
-  Buffer::const_iterator begin = value_begin();
-  Buffer::const_iterator end = value_end();
+  const uint8_t* begin = value();
+  const uint8_t* end = begin + value_size();
 
-  while (begin != end)
+  // The first pass validates the elements and counts them, so that the second pass can
+  // store them with a single allocation instead of growing the container geometrically
+  size_t nElements = 0;
+  const uint8_t* parsedEnd = tlv::splitElements(begin, end,
+    [&nElements] (uint32_t, const uint8_t*, const uint8_t*, const uint8_t*) { ++nElements; });
+  if (parsedEnd != end)
     {
-      Buffer::const_iterator element_begin = begin;
-
-      uint32_t type = tlv::readType(begin, end);
-      uint64_t length = tlv::readVarNumber(begin, end);
+      BOOST_THROW_EXCEPTION(tlv::Error("TLV length exceeds buffer length"));
+    }
 
-      if (length > static_cast<uint64_t>(end - begin))
-        {
-          m_subBlocks.clear();
-          BOOST_THROW_EXCEPTION(tlv::Error("TLV length exceeds buffer length"));
-        }
-      Buffer::const_iterator element_end = begin + length;
+  m_subBlocks.reserve(nElements);
+  Buffer::const_iterator valueBegin = value_begin();
+  tlv::splitElements(begin, end,
+    [this, begin, &valueBegin] (uint32_t type, const uint8_t* elementBegin,
+                                const uint8_t* elementValue, const uint8_t* elementEnd) {
+      m_subBlocks.emplace_back(m_buffer,
+                               type,
+                               valueBegin + (elementBegin - begin), valueBegin + (elementEnd - begin),
+                               valueBegin + (elementValue - begin), valueBegin + (elementEnd - begin));
+    });
+  // don't do recursive parsing, just the top level
+}
 
-      m_subBlocks.push_back(Block(m_buffer,
-                                  type,
-                                  element_begin, element_end,
-                                  begin, element_end));
+/**
+ * @brief Prepend the encoding of @p block, recursively encoding sub-elements that lack wire
+ */
+template<encoding::Tag TAG>
+static size_t
+prependBlockTree(EncodingImpl<TAG>& encoder, const Block& block)
+{
+  if (block.hasWire())
+    return encoder.prependByteArray(block.wire(), block.size());
 
-      begin = element_end;
-      // don't do recursive parsing, just the top level
+  size_t totalLength = 0;
+  if (block.hasValue())
+    {
+      totalLength += encoder.prependByteArray(block.value(), block.value_size());
     }
+  else
+    {
+      for (Block::element_container::const_reverse_iterator i = block.elements().rbegin();
+           i != block.elements().rend(); ++i) {
+        totalLength += prependBlockTree(encoder, *i);
+      }
+    }
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(block.type());
+  return totalLength;
 }
 
 void
@@ -357,49 +383,22 @@ Block::encode()
   if (hasWire())
     return;
 
-  OBufferStream os;
-  tlv::writeVarNumber(os, type());
-
-  if (hasValue())
-    {
-      tlv::writeVarNumber(os, value_size());
-      os.write(reinterpret_cast<const char*>(value()), value_size());
-    }
-  else if (m_subBlocks.size() == 0)
-    {
-      tlv::writeVarNumber(os, 0);
-    }
-  else
-    {
-      size_t valueSize = 0;
-      for (element_const_iterator i = m_subBlocks.begin(); i != m_subBlocks.end(); ++i) {
-        valueSize += i->size();
-      }
+  // estimate the exact size first, so that the wire is written into a single buffer
+  EncodingEstimator estimator;
+  size_t estimatedSize = prependBlockTree(estimator, *this);
 
-      tlv::writeVarNumber(os, valueSize);
-
-      for (element_const_iterator i = m_subBlocks.begin(); i != m_subBlocks.end(); ++i) {
-        if (i->hasWire())
-          os.write(reinterpret_cast<const char*>(i->wire()), i->size());
-        else if (i->hasValue()) {
-          tlv::writeVarNumber(os, i->type());
-          tlv::writeVarNumber(os, i->value_size());
-          os.write(reinterpret_cast<const char*>(i->value()), i->value_size());
-        }
-        else
-          BOOST_THROW_EXCEPTION(Error("Underlying value buffer is empty"));
-      }
-    }
+  EncodingBuffer buffer(estimatedSize, 0);
+  prependBlockTree(buffer, *this);
 
   // now assign correct block
 
-  m_buffer = os.buf();
-  m_begin = m_buffer->begin();
-  m_end   = m_buffer->end();
+  m_buffer = buffer.getBuffer();
+  m_begin = buffer.begin();
+  m_end   = buffer.end();
   m_size  = m_end - m_begin;
 
-  m_value_begin = m_buffer->begin();
-  m_value_end   = m_buffer->end();
+  m_value_begin = m_begin;
+  m_value_end   = m_end;
 
   tlv::readType(m_value_begin, m_value_end);
   tlv::readVarNumber(m_value_begin, m_value_end);
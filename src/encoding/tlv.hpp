@@ -26,6 +26,7 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <cstring>
 
 #include "buffer.hpp"
 #include "endian.hpp"
@@ -101,7 +102,9 @@ enum SignatureTypeValue {
   DigestSha256 = 0,
   SignatureSha256WithRsa = 1,
   // <Unassigned> = 2,
-  SignatureSha256WithEcdsa = 3
+  SignatureSha256WithEcdsa = 3,
+  /// @brief Merkle tree batch signature, see SignatureSha256WithMerkle
+  SignatureSha256WithMerkle = 200
 };
 
 /** @brief TLV codes for SignatureInfo features
@@ -119,6 +122,15 @@ enum {
   DescriptionValue = 514
 };
 
+/** @brief TLV codes inside the SignatureValue of SignatureSha256WithMerkle
+ */
+enum {
+  MerkleLeafIndex = 270,
+  MerkleLeafCount = 271,
+  MerklePathDigest = 272,
+  MerkleRootSignature = 273
+};
+
 /** @brief indicates a possible value of ContentType field
  */
 enum ContentTypeValue {
@@ -195,6 +207,27 @@ template<class InputIterator>
 inline uint32_t
 readType(InputIterator& begin, const InputIterator& end);
 
+/**
+ * @brief Locate consecutive TLV elements in a contiguous buffer
+ *
+ * @param begin     Begin of the buffer
+ * @param end       End of the buffer
+ * @param onElement Callback invoked as onElement(type, elementBegin, valueBegin, elementEnd)
+ *                  for every complete element, in order
+ *
+ * @throws This call never throws exception, other than exceptions thrown by @p onElement
+ *
+ * Scanning stops at the first element that is incomplete or whose TLV-TYPE exceeds 2^32-1.
+ * Elements with 1-octet TLV-TYPE and TLV-LENGTH, the common case, are decoded with a single
+ * 2-octet check.
+ *
+ * @return pointer past the last complete element, which equals @p end if the whole buffer
+ *         consists of complete elements
+ */
+template<class ElementCallback>
+inline const uint8_t*
+splitElements(const uint8_t* begin, const uint8_t* end, const ElementCallback& onElement);
+
 /**
  * @brief Get number of bytes necessary to hold value of VAR-NUMBER
  */
@@ -376,6 +409,73 @@ readVarNumber<std::istream_iterator<uint8_t>>(std::istream_iterator<uint8_t>& be
   return true;
 }
 
+/**
+ * @brief Read VAR-NUMBER from a contiguous buffer
+ *
+ * Multi-octet numbers are read with a single unaligned load.
+ */
+template<>
+inline bool
+readVarNumber<const uint8_t*>(const uint8_t*& begin, const uint8_t* const& end, uint64_t& number)
+{
+  if (begin == end)
+    return false;
+
+  uint8_t firstOctet = *begin;
+  if (firstOctet < 253)
+    {
+      number = firstOctet;
+      ++begin;
+      return true;
+    }
+
+  // 253, 254 and 255 are followed by 2, 4 and 8 octets respectively
+  size_t size = size_t(1) << (firstOctet - 252);
+  if (static_cast<size_t>(end - begin) <= size)
+    return false;
+
+  const uint8_t* value = begin + 1;
+  if (size == 2)
+    {
+      uint16_t word;
+      std::memcpy(&word, value, sizeof(word));
+      number = be16toh(word);
+    }
+  else if (size == 4)
+    {
+      uint32_t word;
+      std::memcpy(&word, value, sizeof(word));
+      number = be32toh(word);
+    }
+  else
+    {
+      uint64_t word;
+      std::memcpy(&word, value, sizeof(word));
+      number = be64toh(word);
+    }
+  begin = value + size;
+  return true;
+}
+
+/**
+ * @brief Read VAR-NUMBER from a Buffer
+ */
+template<>
+inline bool
+readVarNumber<Buffer::const_iterator>(Buffer::const_iterator& begin,
+                                      const Buffer::const_iterator& end,
+                                      uint64_t& number)
+{
+  if (begin == end)
+    return false;
+
+  const uint8_t* first = &*begin;
+  const uint8_t* pos = first;
+  bool isOk = readVarNumber<const uint8_t*>(pos, first + (end - begin), number);
+  begin += pos - first;
+  return isOk;
+}
+
 template<class InputIterator>
 inline uint32_t
 readType(InputIterator& begin, const InputIterator& end)
@@ -389,6 +489,35 @@ readType(InputIterator& begin, const InputIterator& end)
   return static_cast<uint32_t>(type);
 }
 
+template<class ElementCallback>
+inline const uint8_t*
+splitElements(const uint8_t* begin, const uint8_t* end, const ElementCallback& onElement)
+{
+  while (begin != end)
+    {
+      const uint8_t* pos = begin;
+      uint32_t type = 0;
+      uint64_t length = 0;
+      if (end - pos >= 2 && pos[0] < 253 && pos[1] < 253)
+        {
+          type = pos[0];
+          length = pos[1];
+          pos += 2;
+        }
+      else if (!readType(pos, end, type) || !readVarNumber(pos, end, length))
+        {
+          break;
+        }
+
+      if (length > static_cast<uint64_t>(end - pos))
+        break;
+
+      onElement(type, begin, pos, pos + length);
+      begin = pos + length;
+    }
+  return begin;
+}
+
 size_t
 sizeOfVarNumber(uint64_t varNumber)
 {
@@ -86,8 +86,6 @@ Face::expressInterest(const Name& name,
 void
 Face::putData(const Data& data)
 {
-  NS_LOG_INFO (">> Data: " << data.getName());
-
   shared_ptr<const Data> dataPtr;
   try {
     dataPtr = data.shared_from_this();
@@ -95,29 +93,95 @@ Face::putData(const Data& data)
   catch (const bad_weak_ptr& e) {
     NS_LOG_INFO("Face::put WARNING: the supplied Data should be created using make_shared<Data>()");
     dataPtr = make_shared<Data>(data);
+    ++m_impl->m_nCopiedPackets;
   }
 
+  putData(std::move(dataPtr));
+}
+
+void
+Face::putData(shared_ptr<const Data> data)
+{
+  NS_LOG_INFO (">> Data: " << data->getName());
+
   m_impl->m_scheduler.scheduleEvent(time::seconds(0), [=] {
-      m_impl->asyncPutData(dataPtr);
+      m_impl->asyncPutData(data);
     });
 }
 
 void
-Face::putBead(const Bead& bead)
+Face::putData(Data&& data)
 {
-  NS_LOG_INFO (">> Bead: " << bead.getName());
+  putData(make_shared<Data>(std::move(data)));
+}
 
+void
+Face::putBead(const Bead& bead)
+{
   shared_ptr<const Bead> beadPtr;
   try {
     beadPtr = bead.shared_from_this();
   }
   catch (const bad_weak_ptr& e) {
-    NS_LOG_INFO("Face::put WARNING: the supplied Data should be created using make_shared<Data>()");
+    NS_LOG_INFO("Face::put WARNING: the supplied Bead should be created using make_shared<Bead>()");
     beadPtr = make_shared<Bead>(bead);
+    ++m_impl->m_nCopiedPackets;
   }
 
+  putBead(std::move(beadPtr));
+}
+
+void
+Face::putBead(shared_ptr<const Bead> bead)
+{
+  NS_LOG_INFO (">> Bead: " << bead->getName());
+
   m_impl->m_scheduler.scheduleEvent(time::seconds(0), [=] {
-      m_impl->asyncPutBead(beadPtr);
+      m_impl->asyncPutBead(bead);
+    });
+}
+
+void
+Face::putBead(Bead&& bead)
+{
+  putBead(make_shared<Bead>(std::move(bead)));
+}
+
+uint64_t
+Face::getNCopiedPackets() const
+{
+  return m_impl->m_nCopiedPackets;
+}
+
+void
+Face::putDatas(std::vector<shared_ptr<const Data>> data)
+{
+  if (data.empty())
+    return;
+
+  NS_LOG_INFO (">> Data burst: " << data.size() << " packets");
+
+  auto burst = make_shared<std::vector<shared_ptr<const Data>>>(std::move(data));
+  m_impl->m_scheduler.scheduleEvent(time::seconds(0), [=] {
+      for (const auto& dataPtr : *burst) {
+        m_impl->asyncPutData(dataPtr);
+      }
+    });
+}
+
+void
+Face::putBeads(std::vector<shared_ptr<const Bead>> beads)
+{
+  if (beads.empty())
+    return;
+
+  NS_LOG_INFO (">> Bead burst: " << beads.size() << " packets");
+
+  auto burst = make_shared<std::vector<shared_ptr<const Bead>>>(std::move(beads));
+  m_impl->m_scheduler.scheduleEvent(time::seconds(0), [=] {
+      for (const auto& beadPtr : *burst) {
+        m_impl->asyncPutBead(beadPtr);
+      }
     });
 }
 
@@ -312,6 +376,27 @@ Face::unsetInterestFilter(const InterestFilterId* interestFilterId)
     });
 }
 
+const BeadFilterId*
+Face::setBeadFilter(const Name& prefix, const OnBead& onBead)
+{
+  NS_LOG_INFO("Set Bead Filter << " << prefix);
+
+  shared_ptr<BeadFilterRecord> filter = make_shared<BeadFilterRecord>(prefix, onBead);
+
+  m_impl->m_scheduler.scheduleEvent(time::seconds(0),
+                                    [=] { m_impl->asyncSetBeadFilter(filter); });
+
+  return reinterpret_cast<const BeadFilterId*>(filter.get());
+}
+
+void
+Face::unsetBeadFilter(const BeadFilterId* beadFilterId)
+{
+  m_impl->m_scheduler.scheduleEvent(time::seconds(0), [=] {
+      m_impl->asyncUnsetBeadFilter(beadFilterId);
+    });
+}
+
 void
 Face::unregisterPrefix(const RegisteredPrefixId* registeredPrefixId,
                        const UnregisterPrefixSuccessCallback& onSuccess,
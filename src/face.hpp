@@ -50,6 +50,7 @@ class Transport;
 class PendingInterestId;
 class RegisteredPrefixId;
 class InterestFilterId;
+class BeadFilterId;
 
 namespace security {
 class KeyChain;
@@ -75,6 +76,14 @@ typedef function<void(const Interest&)> OnTimeout;
  */
 typedef function<void (const InterestFilter&, const Interest&)> OnInterest;
 
+/**
+ * @brief Callback called when incoming Bead matches the prefix specified in setBeadFilter
+ *
+ * The Bead is passed as a shared pointer and can be retained by the application without
+ * making a copy.
+ */
+typedef function<void(const Name&, const shared_ptr<const Bead>&)> OnBead;
+
 /**
  * @brief Callback called when registerPrefix or setInterestFilter command succeeds
  */
@@ -489,6 +498,29 @@ public: // producer
   void
   unsetInterestFilter(const InterestFilterId* interestFilterId);
 
+  /**
+   * @brief Set Bead filter to dispatch incoming Beads under @p prefix to onBead callback
+   *
+   * All filters whose prefix is a prefix of the Bead name are invoked, in the order they were
+   * set.  This method modifies library's table only and does not register the prefix with
+   * the forwarder.
+   *
+   * @param prefix Name prefix of Beads to dispatch
+   * @param onBead A callback to be called when a matching Bead is received
+   *
+   * @return Opaque Bead filter ID which can be used with unsetBeadFilter
+   */
+  const BeadFilterId*
+  setBeadFilter(const Name& prefix, const OnBead& onBead);
+
+  /**
+   * @brief Remove previously set Bead filter
+   *
+   * @param beadFilterId The ID returned from setBeadFilter.
+   */
+  void
+  unsetBeadFilter(const BeadFilterId* beadFilterId);
+
   /**
    * @brief Unregister prefix from RIB
    *
@@ -519,13 +551,106 @@ public: // producer
    *             asynchronous put() operation finishes.
    *
    * @throws Error when Data size exceeds maximum limit (MAX_NDN_PACKET_SIZE)
+   * @sa getNCopiedPackets
    */
   void
   putData(const Data& data);
 
+  /**
+   * @brief Publish data packet owned by shared pointer
+   *
+   * The packet is handed over to the forwarder without making a copy.
+   */
+  void
+  putData(shared_ptr<const Data> data);
+
+  /**
+   * @brief Publish data packet, moving it into the Face
+   *
+   * The packet is moved into a newly allocated Data.  The wire encoding is not copied.
+   */
+  void
+  putData(Data&& data);
+
+  /**
+   * @brief Publish Bead
+   *
+   * @param bead Bead to publish.  It is highly recommended to use Bead that was created
+   *             using make_shared<Bead>(...).  Otherwise, putBead() will make an extra copy
+   *             of the Bead to ensure its validity until asynchronous putBead() operation
+   *             finishes.
+   * @sa getNCopiedPackets
+   */
   void
   putBead(const Bead& bead);
 
+  /**
+   * @brief Publish Bead owned by shared pointer
+   *
+   * The Bead is handed over to the forwarder without making a copy.
+   */
+  void
+  putBead(shared_ptr<const Bead> bead);
+
+  /**
+   * @brief Publish Bead, moving it into the Face
+   *
+   * The Bead is moved into a newly allocated Bead.  The wire encoding is not copied.
+   */
+  void
+  putBead(Bead&& bead);
+
+  /**
+   * @brief Get number of packets that putData(const Data&) and putBead(const Bead&) had to copy
+   *
+   * A copy is made when the packet passed by reference is not owned by a shared pointer.
+   * A non-zero value means the application should switch to the shared_ptr or rvalue overloads.
+   */
+  uint64_t
+  getNCopiedPackets() const;
+
+  /**
+   * @brief Publish a burst of Data packets
+   *
+   * All packets are handed over to the forwarder in a single scheduled event, instead of one
+   * event per packet as with putData.
+   *
+   * @param first, last range of elements convertible to shared_ptr<const Data>
+   */
+  template<typename Iterator>
+  void
+  putDatas(Iterator first, Iterator last)
+  {
+    putDatas(std::vector<shared_ptr<const Data>>(first, last));
+  }
+
+  /**
+   * @brief Publish a burst of Data packets in a single scheduled event
+   */
+  void
+  putDatas(std::vector<shared_ptr<const Data>> data);
+
+  /**
+   * @brief Publish a burst of Beads
+   *
+   * All Beads are handed over to the forwarder in a single scheduled event, instead of one
+   * event per packet as with putBead.
+   *
+   * @param first, last range of elements convertible to shared_ptr<const Bead>
+   */
+  template<typename Iterator>
+  void
+  putBeads(Iterator first, Iterator last)
+  {
+    putBeads(std::vector<shared_ptr<const Bead>>(first, last));
+  }
+
+  /**
+   * @brief Publish a burst of Beads in a single scheduled event
+   */
+  void
+  putBeads(std::vector<shared_ptr<const Bead>> beads);
+
 public: // IO routine
   /**
    * @brief Noop (kept for compatibility)
@@ -54,6 +54,23 @@ InterestFilter::doesMatch(const Name& name) const
   }
 }
 
+bool
+InterestFilter::doesMatch(const NameView& name) const
+{
+  if (name.size() < m_prefix.size())
+    return false;
+
+  if (!m_prefix.isPrefixOf(name))
+    return false;
+
+  if (hasRegexFilter()) {
+    // regular expression matching requires a Name
+    return m_regexFilter->match(name.toName(), m_prefix.size(), name.size() - m_prefix.size());
+  }
+
+  return true;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const InterestFilter& filter)
 {
@@ -23,6 +23,7 @@
 #define NDN_INTEREST_FILTER_HPP
 
 #include "name.hpp"
+#include "name-view.hpp"
 
 namespace ndn {
 
@@ -106,6 +107,14 @@ public:
   bool
   doesMatch(const Name& name) const;
 
+  /**
+   * @brief Check if the name viewed by @p name matches the filter
+   *
+   * No memory is allocated unless the filter has a regular expression.
+   */
+  bool
+  doesMatch(const NameView& name) const;
+
   const Name&
   getPrefix() const
   {
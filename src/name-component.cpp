@@ -92,98 +92,113 @@ Component::Component(const std::string& str)
 Component
 Component::fromEscapedString(const char* escapedString, size_t beginOffset, size_t endOffset)
 {
-  std::string trimmedString(escapedString + beginOffset, escapedString + endOffset);
-  trim(trimmedString);
-
-  if (trimmedString.compare(0, getSha256DigestUriPrefix().size(),
-                            getSha256DigestUriPrefix()) == 0) {
-    if (trimmedString.size() != getSha256DigestUriPrefix().size() + crypto::SHA256_DIGEST_SIZE * 2)
+  const char* first = escapedString + beginOffset;
+  const char* last = escapedString + endOffset;
+  trim(first, last);
+  size_t size = last - first;
+
+  const std::string& digestPrefix = getSha256DigestUriPrefix();
+  if (size >= digestPrefix.size() && std::equal(digestPrefix.begin(), digestPrefix.end(), first)) {
+    if (size != digestPrefix.size() + crypto::SHA256_DIGEST_SIZE * 2)
       BOOST_THROW_EXCEPTION(Error("Cannot convert to ImplicitSha256DigestComponent"
                                   "(expected sha256 in hex encoding)"));
 
-    try {
-      trimmedString.erase(0, getSha256DigestUriPrefix().size());
-      return fromImplicitSha256Digest(fromHex(trimmedString));
-    }
-    catch (StringHelperError& e) {
-      BOOST_THROW_EXCEPTION(Error("Cannot convert to a ImplicitSha256DigestComponent (invalid hex "
-                                  "encoding)"));
+    uint8_t digest[crypto::SHA256_DIGEST_SIZE];
+    const char* hex = first + digestPrefix.size();
+    for (size_t i = 0; i < crypto::SHA256_DIGEST_SIZE; ++i) {
+      int hi = fromHexChar(hex[2 * i]);
+      int lo = fromHexChar(hex[2 * i + 1]);
+      if (hi < 0 || lo < 0)
+        BOOST_THROW_EXCEPTION(Error("Cannot convert to a ImplicitSha256DigestComponent (invalid hex "
+                                    "encoding)"));
+      digest[i] = static_cast<uint8_t>((hi << 4) | lo);
     }
+    return fromImplicitSha256Digest(digest, sizeof(digest));
   }
   else {
-    std::string value = unescape(trimmedString);
+    // the unescaped value is never longer than the escaped string
+    uint8_t stackBuffer[256];
+    std::vector<uint8_t> heapBuffer;
+    uint8_t* value = stackBuffer;
+    if (size > sizeof(stackBuffer)) {
+      heapBuffer.resize(size);
+      value = heapBuffer.data();
+    }
+    size_t valueSize = unescape(first, size, value);
 
-    if (value.find_first_not_of(".") == std::string::npos) {
+    if (std::find_if(value, value + valueSize, [] (uint8_t x) { return x != '.'; }) ==
+        value + valueSize) {
       // Special case for component of only periods.
-      if (value.size() <= 2)
+      if (valueSize <= 2)
         // Zero, one or two periods is illegal.  Ignore this component.
         BOOST_THROW_EXCEPTION(Error("Illegal URI (name component cannot be . or ..)"));
       else
         // Remove 3 periods.
-        return Component(reinterpret_cast<const uint8_t*>(&value[3]), value.size() - 3);
+        return Component(value + 3, valueSize - 3);
     }
     else
-      return Component(reinterpret_cast<const uint8_t*>(&value[0]), value.size());
+      return Component(value, valueSize);
   }
 }
 
+size_t
+Component::getMaxUriSize() const
+{
+  if (type() == tlv::ImplicitSha256DigestComponent)
+    return getSha256DigestUriPrefix().size() + value_size() * 2;
+  else
+    // every octet is escaped, or "..." is added to a value of only periods
+    return value_size() * 3 + 3;
+}
 
-void
-Component::toUri(std::ostream& result) const
+size_t
+Component::toUri(char* buffer) const
 {
-  if (type() == tlv::ImplicitSha256DigestComponent) {
-    result << getSha256DigestUriPrefix();
+  const uint8_t* value = this->value();
+  size_t valueSize = value_size();
 
-    printHex(result, value(), value_size(), false);
-  }
-  else {
-    const uint8_t* value = this->value();
-    size_t valueSize = value_size();
+  if (type() == tlv::ImplicitSha256DigestComponent) {
+    static const char HEX_LOWER[] = "0123456789abcdef";
 
-    bool gotNonDot = false;
+    const std::string& prefix = getSha256DigestUriPrefix();
+    char* out = std::copy(prefix.begin(), prefix.end(), buffer);
     for (size_t i = 0; i < valueSize; ++i) {
-      if (value[i] != 0x2e) {
-        gotNonDot = true;
-        break;
-      }
-    }
-    if (!gotNonDot) {
-      // Special case for component of zero or more periods.  Add 3 periods.
-      result << "...";
-      for (size_t i = 0; i < valueSize; ++i)
-        result << '.';
-    }
-    else {
-      // In case we need to escape, set to upper case hex and save the previous flags.
-      std::ios::fmtflags saveFlags = result.flags(std::ios::hex | std::ios::uppercase);
-
-      for (size_t i = 0; i < valueSize; ++i) {
-        uint8_t x = value[i];
-        // Check for 0-9, A-Z, a-z, (+), (-), (.), (_)
-        if ((x >= 0x30 && x <= 0x39) || (x >= 0x41 && x <= 0x5a) ||
-            (x >= 0x61 && x <= 0x7a) || x == 0x2b || x == 0x2d ||
-            x == 0x2e || x == 0x5f)
-          result << x;
-        else {
-          result << '%';
-          if (x < 16)
-            result << '0';
-          result << static_cast<uint32_t>(x);
-        }
-      }
-
-      // Restore.
-      result.flags(saveFlags);
+      *out++ = HEX_LOWER[value[i] >> 4];
+      *out++ = HEX_LOWER[value[i] & 0x0F];
     }
+    return out - buffer;
+  }
+
+  if (std::find_if(value, value + valueSize, [] (uint8_t x) { return x != '.'; }) ==
+      value + valueSize) {
+    // Special case for component of zero or more periods.  Add 3 periods.
+    std::fill_n(buffer, valueSize + 3, '.');
+    return valueSize + 3;
+  }
+
+  return escape(value, valueSize, buffer);
+}
+
+void
+Component::toUri(std::ostream& result) const
+{
+  char stackBuffer[256];
+  size_t maxSize = getMaxUriSize();
+  if (maxSize <= sizeof(stackBuffer)) {
+    result.write(stackBuffer, toUri(stackBuffer));
+  }
+  else {
+    std::vector<char> buffer(maxSize);
+    result.write(buffer.data(), toUri(buffer.data()));
   }
 }
 
 std::string
 Component::toUri() const
 {
-  std::ostringstream os;
-  toUri(os);
-  return os.str();
+  std::string result(getMaxUriSize(), '\0');
+  result.resize(toUri(&result[0]));
+  return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
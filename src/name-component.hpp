@@ -255,6 +255,24 @@ public:
   std::string
   toUri() const;
 
+  /**
+   * @brief Write *this into a caller-provided buffer, escaping characters according to the
+   *        NDN URI Scheme
+   *
+   * This also adds "..." to a value with zero or more "."
+   *
+   * @param buffer buffer with room for at least getMaxUriSize() characters
+   * @return number of characters written (no terminating null character is written)
+   */
+  size_t
+  toUri(char* buffer) const;
+
+  /**
+   * @brief Get the maximum number of characters written by toUri(char*)
+   */
+  size_t
+  getMaxUriSize() const;
+
   ////////////////////////////////////////////////////////////////////////////////
 
   /**
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "name-view.hpp"
+
+namespace ndn {
+
+Name
+NameView::toName() const
+{
+  Name name;
+  for (const Component& component : *this) {
+    name.append(component);
+  }
+  return name;
+}
+
+std::string
+NameView::toUri() const
+{
+  std::ostringstream os;
+  os << *this;
+  return os.str();
+}
+
+PartialNameView
+NameView::getSubName(ssize_t iStartComponent, size_t nComponents) const
+{
+  ssize_t iStart = iStartComponent < 0 ? this->size() + iStartComponent : iStartComponent;
+  iStart = std::max(iStart, static_cast<ssize_t>(0));
+  iStart = std::min(iStart, static_cast<ssize_t>(this->size()));
+
+  size_t iEnd = this->size();
+  if (nComponents != Name::npos)
+    iEnd = std::min(this->size(), iStart + nComponents);
+
+  return PartialNameView(m_begin + iStart, m_begin + iEnd);
+}
+
+bool
+NameView::isPrefixOf(const NameView& other) const
+{
+  if (size() > other.size())
+    return false;
+
+  return std::equal(begin(), end(), other.begin());
+}
+
+int
+NameView::compare(const NameView& other) const
+{
+  size_t count = std::min(size(), other.size());
+  for (size_t i = 0; i < count; ++i) {
+    int comp = get(i).compare(other.get(i));
+    if (comp != 0) {
+      return comp;
+    }
+  }
+  return static_cast<int>(size()) - static_cast<int>(other.size());
+}
+
+size_t
+NameView::getHash() const
+{
+  size_t hash = 0;
+  for (const Component& component : *this) {
+    hash = Name::extendHash(hash, component);
+  }
+  return hash;
+}
+
+bool
+NameView::operator==(const NameView& other) const
+{
+  return size() == other.size() && std::equal(begin(), end(), other.begin());
+}
+
+std::ostream&
+operator<<(std::ostream& os, const NameView& name)
+{
+  if (name.empty()) {
+    os << "/";
+  }
+  else {
+    for (const name::Component& component : name) {
+      os << "/";
+      component.toUri(os);
+    }
+  }
+  return os;
+}
+
+} // namespace ndn
@@ -0,0 +1,264 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_NAME_VIEW_HPP
+#define NDN_NAME_VIEW_HPP
+
+#include "name.hpp"
+
+namespace ndn {
+
+class NameView;
+
+/**
+ * @brief Non-owning view of an arbitrary sequence of name components
+ */
+typedef NameView PartialNameView;
+
+/**
+ * @brief Non-owning view of a contiguous range of components of an existing Name
+ *
+ * A NameView refers to the components of a Name without copying them, so taking sub-names and
+ * prefixes, comparing and hashing do not allocate memory.  The view is valid only as long as
+ * the viewed Name exists and is not modified.
+ *
+ * @warning Name::wireEncode() const on a Name whose components were changed since its last
+ *          encoding (e.g., by append) re-parses the new encoding and replaces all components,
+ *          which invalidates every view of that Name.  Encode the Name before taking views.
+ */
+class NameView
+{
+public:
+  typedef Name::Component              Component;
+  typedef Component                    value_type;
+  typedef const Component&             const_reference;
+  typedef Name::const_iterator         const_iterator;
+  typedef Name::const_reverse_iterator const_reverse_iterator;
+  typedef Name::size_type              size_type;
+
+  /**
+   * @brief Create an empty view
+   */
+  NameView()
+    : m_begin()
+    , m_end()
+  {
+  }
+
+  /**
+   * @brief Create a view of all components of @p name
+   * @note This constructor allows implicit conversion from Name.
+   */
+  NameView(const Name& name)
+    : m_begin(name.begin())
+    , m_end(name.end())
+  {
+  }
+
+  /**
+   * @brief A view of a temporary Name would dangle once the temporary is destroyed
+   */
+  NameView(Name&&) = delete;
+
+  /**
+   * @brief Create a view of the components in [@p first, @p last)
+   */
+  NameView(const_iterator first, const_iterator last)
+    : m_begin(first)
+    , m_end(last)
+  {
+  }
+
+  /**
+   * @brief Create a new Name with a copy of the viewed components
+   */
+  Name
+  toName() const;
+
+  std::string
+  toUri() const;
+
+  bool
+  empty() const
+  {
+    return m_begin == m_end;
+  }
+
+  size_t
+  size() const
+  {
+    return m_end - m_begin;
+  }
+
+  const Component&
+  get(ssize_t i) const
+  {
+    if (i >= 0)
+      return m_begin[i];
+    else
+      return m_end[i];
+  }
+
+  const Component&
+  operator[](ssize_t i) const
+  {
+    return get(i);
+  }
+
+  /**
+   * @brief Get the component at the given index
+   * @throw Name::Error the component does not exist
+   */
+  const Component&
+  at(ssize_t i) const
+  {
+    if ((i >= 0 && static_cast<size_t>(i) >= size()) ||
+        (i < 0  && static_cast<size_t>(-i) > size()))
+      BOOST_THROW_EXCEPTION(Name::Error("Requested component does not exist (out of bounds)"));
+
+    return get(i);
+  }
+
+  /**
+   * @brief Get a view of a range of the viewed components
+   *
+   * This has the same semantics as Name::getSubName, without copying the components.
+   */
+  PartialNameView
+  getSubName(ssize_t iStartComponent, size_t nComponents = Name::npos) const;
+
+  /**
+   * @brief Get a view of the first @p nComponents components, or of all components except
+   *        the last -@p nComponents if @p nComponents is negative
+   */
+  PartialNameView
+  getPrefix(ssize_t nComponents) const
+  {
+    if (nComponents < 0)
+      return getSubName(0, size() + nComponents);
+    else
+      return getSubName(0, nComponents);
+  }
+
+  /**
+   * @brief Check if the viewed components are a prefix of @p other
+   */
+  bool
+  isPrefixOf(const NameView& other) const;
+
+  /**
+   * @brief Compare the viewed components with @p other in NDN canonical order
+   * @return 0 if equal, a negative value if this view is less than @p other, otherwise a
+   *         positive value
+   */
+  int
+  compare(const NameView& other) const;
+
+  /**
+   * @brief Get the hash value of the viewed components
+   *
+   * The value equals Name::getHash() of a Name with the same components.  It is not cached,
+   * and is computed in O(size()).
+   */
+  size_t
+  getHash() const;
+
+  bool
+  operator==(const NameView& other) const;
+
+  bool
+  operator!=(const NameView& other) const
+  {
+    return !(*this == other);
+  }
+
+  bool
+  operator<(const NameView& other) const
+  {
+    return compare(other) < 0;
+  }
+
+  bool
+  operator<=(const NameView& other) const
+  {
+    return compare(other) <= 0;
+  }
+
+  bool
+  operator>(const NameView& other) const
+  {
+    return compare(other) > 0;
+  }
+
+  bool
+  operator>=(const NameView& other) const
+  {
+    return compare(other) >= 0;
+  }
+
+  const_iterator
+  begin() const
+  {
+    return m_begin;
+  }
+
+  const_iterator
+  end() const
+  {
+    return m_end;
+  }
+
+  const_reverse_iterator
+  rbegin() const
+  {
+    return const_reverse_iterator(end());
+  }
+
+  const_reverse_iterator
+  rend() const
+  {
+    return const_reverse_iterator(begin());
+  }
+
+private:
+  const_iterator m_begin;
+  const_iterator m_end;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const NameView& name);
+
+} // namespace ndn
+
+namespace std {
+template<>
+struct hash<ndn::NameView>
+{
+  size_t
+  operator()(const ndn::NameView& name) const
+  {
+    return name.getHash();
+  }
+};
+
+} // namespace std
+
+#endif // NDN_NAME_VIEW_HPP
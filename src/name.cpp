@@ -24,6 +24,7 @@
  */
 
 #include "name.hpp"
+#include "name-view.hpp"
 
 #include "util/time.hpp"
 #include "util/string-helper.hpp"
@@ -45,21 +46,29 @@ const size_t Name::npos = std::numeric_limits<size_t>::max();
 
 Name::Name()
   : m_nameBlock(tlv::Name)
+  , m_hash(0)
+  , m_nHashedComponents(0)
 {
 }
 
 Name::Name(const Block& wire)
+  : m_hash(0)
+  , m_nHashedComponents(0)
 {
   m_nameBlock = wire;
   m_nameBlock.parse();
 }
 
 Name::Name(const char* uri)
+  : m_hash(0)
+  , m_nHashedComponents(0)
 {
   construct(uri);
 }
 
 Name::Name(const std::string& uri)
+  : m_hash(0)
+  , m_nHashedComponents(0)
 {
   construct(uri.c_str());
 }
@@ -112,58 +121,56 @@ Name::wireDecode(const Block& wire)
 
   m_nameBlock = wire;
   m_nameBlock.parse();
+  m_hash = 0;
+  m_nHashedComponents = 0;
 }
 
 void
-Name::construct(const char* uriOrig)
+Name::construct(const char* uri)
 {
   clear();
 
-  std::string uri = uriOrig;
-  trim(uri);
-  if (uri.size() == 0)
+  const char* first = uri;
+  const char* last = uri + std::char_traits<char>::length(uri);
+  trim(first, last);
+  if (first == last)
     return;
 
-  size_t iColon = uri.find(':');
-  if (iColon != std::string::npos) {
+  const char* colon = std::find(first, last, ':');
+  if (colon != last) {
     // Make sure the colon came before a '/'.
-    size_t iFirstSlash = uri.find('/');
-    if (iFirstSlash == std::string::npos || iColon < iFirstSlash) {
+    const char* firstSlash = std::find(first, last, '/');
+    if (colon < firstSlash) {
       // Omit the leading protocol such as ndn:
-      uri.erase(0, iColon + 1);
-      trim(uri);
+      first = colon + 1;
+      trim(first, last);
     }
   }
 
   // Trim the leading slash and possibly the authority.
-  if (uri[0] == '/') {
-    if (uri.size() >= 2 && uri[1] == '/') {
+  if (first != last && *first == '/') {
+    if (last - first >= 2 && first[1] == '/') {
       // Strip the authority following "//".
-      size_t iAfterAuthority = uri.find('/', 2);
-      if (iAfterAuthority == std::string::npos)
+      const char* afterAuthority = std::find(first + 2, last, '/');
+      if (afterAuthority == last)
         // Unusual case: there was only an authority.
         return;
-      else {
-        uri.erase(0, iAfterAuthority + 1);
-        trim(uri);
-      }
+      else
+        first = afterAuthority + 1;
     }
     else {
-      uri.erase(0, 1);
-      trim(uri);
+      first = first + 1;
     }
+    trim(first, last);
   }
 
-  size_t iComponentStart = 0;
-
   // Unescape the components.
-  while (iComponentStart < uri.size()) {
-    size_t iComponentEnd = uri.find("/", iComponentStart);
-    if (iComponentEnd == std::string::npos)
-      iComponentEnd = uri.size();
-
-    append(Component::fromEscapedString(&uri[0], iComponentStart, iComponentEnd));
-    iComponentStart = iComponentEnd + 1;
+  while (first < last) {
+    const char* componentEnd = std::find(first, last, '/');
+    append(Component::fromEscapedString(first, 0, componentEnd - first));
+    if (componentEnd == last)
+      break;
+    first = componentEnd + 1;
   }
 }
 
@@ -182,9 +189,21 @@ Name::set(const std::string& uri)
 std::string
 Name::toUri() const
 {
-  std::ostringstream os;
-  os << *this;
-  return os.str();
+  if (empty())
+    return "/";
+
+  size_t maxSize = 0;
+  for (const Component& component : *this)
+    maxSize += 1 + component.getMaxUriSize();
+
+  std::string uri(maxSize, '\0');
+  char* out = &uri[0];
+  for (const Component& component : *this) {
+    *out++ = '/';
+    out += component.toUri(out);
+  }
+  uri.resize(out - &uri[0]);
+  return uri;
 }
 
 Name&
@@ -270,6 +289,39 @@ Name::appendImplicitSha256Digest(const uint8_t* digest, size_t digestSize)
   return *this;
 }
 
+size_t
+Name::extendHash(size_t hash, const Component& component)
+{
+  boost::hash_combine(hash, component.type());
+  boost::hash_combine(hash, boost::hash_range(component.value(),
+                                              component.value() + component.value_size()));
+  return hash;
+}
+
+size_t
+Name::getHash() const
+{
+  for (; m_nHashedComponents < size(); ++m_nHashedComponents) {
+    m_hash = extendHash(m_hash, get(m_nHashedComponents));
+  }
+  return m_hash;
+}
+
+std::vector<size_t>
+Name::getPrefixHashes() const
+{
+  std::vector<size_t> hashes;
+  hashes.reserve(size() + 1);
+  hashes.push_back(0);
+  for (const Component& component : *this) {
+    hashes.push_back(extendHash(hashes.back(), component));
+  }
+
+  m_hash = hashes.back();
+  m_nHashedComponents = size();
+  return hashes;
+}
+
 PartialName
 Name::getSubName(ssize_t iStartComponent, size_t nComponents) const
 {
@@ -332,6 +384,12 @@ Name::isPrefixOf(const Name& name) const
   return true;
 }
 
+bool
+Name::isPrefixOf(const NameView& name) const
+{
+  return NameView(*this).isPrefixOf(name);
+}
+
 int
 Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t count2) const
 {
@@ -382,8 +440,7 @@ namespace std {
 size_t
 hash<ndn::Name>::operator()(const ndn::Name& name) const
 {
-  return boost::hash_range(name.wireEncode().wire(),
-                           name.wireEncode().wire() + name.wireEncode().size());
+  return name.getHash();
 }
 
 } // namespace std
@@ -34,6 +34,7 @@
 namespace ndn {
 
 class Name;
+class NameView;
 
 /**
  * @brief Partial name abstraction to represent an arbitrary sequence of name components
@@ -218,6 +219,8 @@ public:
   clear()
   {
     m_nameBlock = Block(tlv::Name);
+    m_hash = 0;
+    m_nHashedComponents = 0;
   }
 
   /**
@@ -376,6 +379,23 @@ public:
   bool
   equals(const Name& name) const;
 
+  /**
+   * @brief Get the hash value of this name, which equals std::hash<Name>()(*this)
+   *
+   * The hash value is computed incrementally over the components and cached.  Appending
+   * components to the name only hashes the new components, so hashing every prefix of a name
+   * while building it one component at a time costs O(n) in total.
+   */
+  size_t
+  getHash() const;
+
+  /**
+   * @brief Compute the hash values of all prefixes of this name in a single pass
+   * @return a vector of size() + 1 elements, where element i equals getPrefix(i).getHash()
+   */
+  std::vector<size_t>
+  getPrefixHashes() const;
+
   /**
    * @brief Check if the N components of this name are the same as the first N components
    *        of the given name.
@@ -387,6 +407,14 @@ public:
   bool
   isPrefixOf(const Name& name) const;
 
+  /**
+   * @brief Check if this name is a prefix of the name viewed by @p name
+   *
+   * This allows checking against a prefix or a sub-name of another name without copying it.
+   */
+  bool
+  isPrefixOf(const NameView& name) const;
+
   //
   // vector equivalent interface.
   //
@@ -611,6 +639,16 @@ private:
   void
   construct(const char* uri);
 
+  /** @brief extend the hash value of a name by one component
+   *
+   *  The hash value of a name is obtained by extending 0 by each component in order.
+   */
+  static size_t
+  extendHash(size_t hash, const Component& component);
+
+  friend class NameView;
+  friend class CompactName;
+
 public:
   /** \brief indicates "until the end" in getSubName and compare
    */
@@ -618,6 +656,14 @@ public:
 
 private:
   mutable Block m_nameBlock;
+
+  /** @brief hash value of the first m_nHashedComponents components
+   *
+   *  The components of a name can only be appended to, or replaced altogether, so the cached
+   *  value stays valid until the name is cleared or decoded again.
+   */
+  mutable size_t m_hash;
+  mutable size_t m_nHashedComponents;
 };
 
 std::ostream&
@@ -315,6 +315,9 @@ Certificate::printCertificate(std::ostream& oss, const std::string& indent) cons
     case tlv::SignatureTypeValue::SignatureSha256WithEcdsa:
       os << "SignatureSha256WithEcdsa";
       break;
+    case tlv::SignatureTypeValue::SignatureSha256WithMerkle:
+      os << "SignatureSha256WithMerkle";
+      break;
     default:
       os << "Unknown Signature Type";
     }
@@ -102,6 +102,7 @@ public:
       {
       case tlv::SignatureSha256WithRsa:
       case tlv::SignatureSha256WithEcdsa:
+      case tlv::SignatureSha256WithMerkle:
         {
           if (!static_cast<bool>(m_keyLocatorChecker))
             BOOST_THROW_EXCEPTION(Error("Strong signature requires KeyLocatorChecker"));
@@ -173,6 +174,7 @@ private:
           {
           case tlv::SignatureSha256WithRsa:
           case tlv::SignatureSha256WithEcdsa:
+          case tlv::SignatureSha256WithMerkle:
             {
               if (!signature.hasKeyLocator()) {
                 onValidationFailed(packet.shared_from_this(),
@@ -243,7 +245,8 @@ public:
       m_signers[(*it)->getName().getPrefix(-1)] = (*it);
 
     if (sigType != tlv::SignatureSha256WithRsa &&
-        sigType != tlv::SignatureSha256WithEcdsa)
+        sigType != tlv::SignatureSha256WithEcdsa &&
+        sigType != tlv::SignatureSha256WithMerkle)
       {
         BOOST_THROW_EXCEPTION(Error("FixedSigner is only meaningful for strong signature type"));
       }
@@ -312,6 +315,7 @@ private:
           {
           case tlv::SignatureSha256WithRsa:
           case tlv::SignatureSha256WithEcdsa:
+          case tlv::SignatureSha256WithMerkle:
             {
               if (!signature.hasKeyLocator()) {
                 onValidationFailed(packet.shared_from_this(),
@@ -550,6 +554,8 @@ private:
       return tlv::SignatureSha256WithRsa;
     else if (boost::iequals(sigType, "ecdsa-sha256"))
       return tlv::SignatureSha256WithEcdsa;
+    else if (boost::iequals(sigType, "merkle-sha256"))
+      return tlv::SignatureSha256WithMerkle;
     else if (boost::iequals(sigType, "sha256"))
       return tlv::DigestSha256;
     else
@@ -27,6 +27,7 @@
 #include "../../common.hpp"
 #include "../../data.hpp"
 #include "../../interest.hpp"
+#include "../../name-view.hpp"
 #include "../../util/regex.hpp"
 #include "../security-common.hpp"
 #include <boost/algorithm/string.hpp>
@@ -66,13 +67,13 @@ public:
     if (interest.getName().size() < signed_interest::MIN_LENGTH)
       return false;
 
-    Name unsignedName = interest.getName().getPrefix(-signed_interest::MIN_LENGTH);
+    NameView unsignedName = NameView(interest.getName()).getPrefix(-signed_interest::MIN_LENGTH);
     return matchName(unsignedName);
   }
 
 protected:
   virtual bool
-  matchName(const Name& name) = 0;
+  matchName(const NameView& name) = 0;
 };
 
 class RelationNameFilter : public Filter
@@ -98,7 +99,7 @@ public:
 
 protected:
   virtual bool
-  matchName(const Name& name)
+  matchName(const NameView& name)
   {
     switch (m_relation)
       {
@@ -134,9 +135,9 @@ public:
 
 protected:
   virtual bool
-  matchName(const Name& name)
+  matchName(const NameView& name)
   {
-    return m_regex.match(name);
+    return m_regex.match(name.toName());
   }
 
 private:
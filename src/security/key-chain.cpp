@@ -22,6 +22,7 @@
  */
 
 #include "key-chain.hpp"
+#include "merkle-tree.hpp"
 
 #include "../util/random.hpp"
 #include "../util/config-file.hpp"
@@ -513,6 +514,16 @@ KeyChain::prepareSignatureInfo(const SigningInfo& params)
   return std::make_tuple(signingCert->getPublicKeyName(), sigInfo);
 }
 
+SigningContext
+KeyChain::prepareSigningContext(const SigningInfo& params)
+{
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+
+  return SigningContext(keyName, sigInfo, params.getDigestAlgorithm());
+}
+
 void
 KeyChain::sign(Data& data, const SigningInfo& params)
 {
@@ -525,6 +536,20 @@ KeyChain::sign(Interest& interest, const SigningInfo& params)
   signImpl(interest, params);
 }
 
+void
+KeyChain::sign(Data& data, const SigningContext& context)
+{
+  signPacketWrapper(data, context.getSignature(),
+                    context.getKeyName(), context.getDigestAlgorithm());
+}
+
+void
+KeyChain::sign(Interest& interest, const SigningContext& context)
+{
+  signPacketWrapper(interest, context.getSignature(),
+                    context.getKeyName(), context.getDigestAlgorithm());
+}
+
 Block
 KeyChain::sign(const uint8_t* buffer, size_t bufferLength, const SigningInfo& params)
 {
@@ -534,6 +559,47 @@ KeyChain::sign(const uint8_t* buffer, size_t bufferLength, const SigningInfo& pa
   return pureSign(buffer, bufferLength, keyName, DIGEST_ALGORITHM_SHA256);
 }
 
+void
+KeyChain::signBatch(std::vector<Data>& packets, const SigningInfo& params)
+{
+  if (packets.empty())
+    return;
+
+  if (params.getSignerType() == SigningInfo::SIGNER_TYPE_SHA256) {
+    for (Data& data : packets)
+      signImpl(data, params);
+    return;
+  }
+
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+  sigInfo.setSignatureType(tlv::SignatureSha256WithMerkle);
+  Signature signature(sigInfo);
+
+  std::vector<ConstBufferPtr> leafHashes;
+  leafHashes.reserve(packets.size());
+  for (Data& data : packets) {
+    data.setSignature(signature);
+
+    EncodingBuffer encoder;
+    data.wireEncode(encoder, true);
+    leafHashes.push_back(MerkleTree::hashLeaf(encoder.buf(), encoder.size()));
+  }
+
+  MerkleTree tree(std::move(leafHashes));
+  Block rootSignature = pureSign(tree.getRoot()->buf(), tree.getRoot()->size(),
+                                 keyName, params.getDigestAlgorithm());
+
+  for (size_t i = 0; i < packets.size(); ++i) {
+    Block sigValue = SignatureSha256WithMerkle::encodeValue(i, packets.size(), tree.getPath(i),
+                                                            rootSignature);
+    EncodingBuffer encoder;
+    packets[i].wireEncode(encoder, true);
+    packets[i].wireEncode(encoder, sigValue);
+  }
+}
+
 Signature
 KeyChain::sign(const uint8_t* buffer, size_t bufferLength, const Name& certificateName)
 {
@@ -30,8 +30,10 @@
 #include "secured-bag.hpp"
 #include "signature-sha256-with-rsa.hpp"
 #include "signature-sha256-with-ecdsa.hpp"
+#include "signature-sha256-with-merkle.hpp"
 #include "digest-sha256.hpp"
 #include "signing-info.hpp"
+#include "signing-context.hpp"
 
 #include "../interest.hpp"
 #include "../util/crypto.hpp"
@@ -292,6 +294,40 @@ public:
   void
   sign(Interest& interest, const SigningInfo& params = DEFAULT_SIGNING_INFO);
 
+  /**
+   * @brief Resolve the signing key and prepare the SignatureInfo for @p params
+   *
+   * The returned context can be used to sign any number of packets with
+   * sign(Data&, const SigningContext&) or sign(Interest&, const SigningContext&), which do not
+   * look up the signing certificate in the PIB again.  It is not updated when the PIB changes.
+   *
+   * @param params The signing parameters.
+   * @throws Error if the requested signing method cannot be satisfied.
+   * @see SigningContext
+   */
+  SigningContext
+  prepareSigningContext(const SigningInfo& params = DEFAULT_SIGNING_INFO);
+
+  /**
+   * @brief Sign data with a signing context prepared by prepareSigningContext
+   *
+   * @param data The data to sign
+   * @param context The signing context.
+   * @throws Error if signing fails.
+   */
+  void
+  sign(Data& data, const SigningContext& context);
+
+  /**
+   * @brief Sign interest with a signing context prepared by prepareSigningContext
+   *
+   * @param interest The interest to sign
+   * @param context The signing context.
+   * @throws Error if signing fails.
+   */
+  void
+  sign(Interest& interest, const SigningContext& context);
+
   /**
    * @brief Sign buffer according to the supplied signing information
    *
@@ -305,6 +341,25 @@ public:
   Block
   sign(const uint8_t* buffer, size_t bufferLength, const SigningInfo& params);
 
+  /**
+   * @brief Sign a batch of Data packets with one signing operation
+   *
+   * A Merkle tree is built over the signed portions of @p packets and only its root is
+   * signed with the key selected by @p params.  Each packet gets a SignatureSha256WithMerkle
+   * signature carrying its inclusion proof and the signature of the root, so that it can be
+   * verified on its own with Validator::verifySignature.
+   *
+   * With SigningInfo::SIGNER_TYPE_SHA256 there is no key operation to amortize, and each
+   * packet gets a DigestSha256 signature instead.
+   *
+   * @param packets The packets to be signed.
+   * @param params The signing parameters.
+   * @throws Error if signing fails.
+   * @see SigningInfo, SignatureSha256WithMerkle
+   */
+  void
+  signBatch(std::vector<Data>& packets, const SigningInfo& params = DEFAULT_SIGNING_INFO);
+
   /**
    * @deprecated use sign sign(T&, const SigningInfo&)
    * @brief Sign packet with a particular certificate.
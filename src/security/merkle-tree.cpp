@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "merkle-tree.hpp"
+#include "../util/digest.hpp"
+
+namespace ndn {
+namespace security {
+
+static const uint8_t LEAF_PREFIX = 0x00;
+static const uint8_t NODE_PREFIX = 0x01;
+
+MerkleTree::MerkleTree(std::vector<ConstBufferPtr> leafHashes)
+{
+  if (leafHashes.empty())
+    BOOST_THROW_EXCEPTION(Error("Merkle tree must have at least one leaf"));
+
+  m_levels.push_back(std::move(leafHashes));
+  while (m_levels.back().size() > 1) {
+    const std::vector<ConstBufferPtr>& level = m_levels.back();
+
+    std::vector<ConstBufferPtr> parents;
+    parents.reserve((level.size() + 1) / 2);
+    for (size_t i = 0; i + 1 < level.size(); i += 2) {
+      parents.push_back(hashChildren(*level[i], *level[i + 1]));
+    }
+    if (level.size() % 2 == 1) {
+      parents.push_back(level.back());
+    }
+
+    m_levels.push_back(std::move(parents));
+  }
+}
+
+std::vector<ConstBufferPtr>
+MerkleTree::getPath(size_t leafIndex) const
+{
+  if (leafIndex >= getLeafCount())
+    BOOST_THROW_EXCEPTION(Error("Leaf index is out of range"));
+
+  std::vector<ConstBufferPtr> path;
+  size_t index = leafIndex;
+  for (size_t i = 0; i + 1 < m_levels.size(); ++i) {
+    size_t sibling = index ^ 1;
+    // a promoted node has no sibling on this level
+    if (sibling < m_levels[i].size()) {
+      path.push_back(m_levels[i][sibling]);
+    }
+    index >>= 1;
+  }
+  return path;
+}
+
+ConstBufferPtr
+MerkleTree::computeRoot(const ConstBufferPtr& leafHash, uint64_t leafIndex, uint64_t leafCount,
+                        const std::vector<ConstBufferPtr>& path)
+{
+  // RFC 9162 section 2.1.3.2
+  if (leafIndex >= leafCount)
+    return nullptr;
+
+  uint64_t index = leafIndex;
+  uint64_t lastIndex = leafCount - 1;
+  ConstBufferPtr hash = leafHash;
+  for (const ConstBufferPtr& sibling : path) {
+    if (lastIndex == 0)
+      return nullptr;
+
+    if ((index & 1) == 1 || index == lastIndex) {
+      hash = hashChildren(*sibling, *hash);
+      // skip the levels where this node is promoted
+      while ((index & 1) == 0 && index != 0) {
+        index >>= 1;
+        lastIndex >>= 1;
+      }
+    }
+    else {
+      hash = hashChildren(*hash, *sibling);
+    }
+    index >>= 1;
+    lastIndex >>= 1;
+  }
+
+  if (lastIndex != 0)
+    return nullptr;
+
+  return hash;
+}
+
+ConstBufferPtr
+MerkleTree::hashLeaf(const uint8_t* buf, size_t size)
+{
+  util::Sha256 digest;
+  digest.update(&LEAF_PREFIX, 1);
+  digest.update(buf, size);
+  return digest.computeDigest();
+}
+
+ConstBufferPtr
+MerkleTree::hashChildren(const Buffer& left, const Buffer& right)
+{
+  util::Sha256 digest;
+  digest.update(&NODE_PREFIX, 1);
+  digest.update(left.buf(), left.size());
+  digest.update(right.buf(), right.size());
+  return digest.computeDigest();
+}
+
+} // namespace security
+} // namespace ndn
@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_SECURITY_MERKLE_TREE_HPP
+#define NDN_SECURITY_MERKLE_TREE_HPP
+
+#include "../common.hpp"
+#include "../encoding/buffer.hpp"
+
+#include <vector>
+
+namespace ndn {
+namespace security {
+
+/** @brief Merkle hash tree over a sequence of leaves
+ *
+ *  The tree is shaped and hashed as in RFC 6962 section 2.1: a leaf hash is
+ *  SHA256(0x00 || leaf), an interior node hash is SHA256(0x01 || left || right), and
+ *  the last node of a level with an odd number of nodes is promoted unchanged.
+ *  An inclusion proof of a leaf is the list of sibling hashes from the leaf up to the root.
+ */
+class MerkleTree
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /** @brief build the tree over @p leafHashes
+   *  @param leafHashes hashes of the leaves, computed with hashLeaf
+   *  @throw Error @p leafHashes is empty
+   */
+  explicit
+  MerkleTree(std::vector<ConstBufferPtr> leafHashes);
+
+  size_t
+  getLeafCount() const
+  {
+    return m_levels.front().size();
+  }
+
+  const ConstBufferPtr&
+  getRoot() const
+  {
+    return m_levels.back().front();
+  }
+
+  /** @return inclusion proof of the leaf at @p leafIndex
+   *  @throw Error @p leafIndex is out of range
+   */
+  std::vector<ConstBufferPtr>
+  getPath(size_t leafIndex) const;
+
+  /** @brief compute the root hash from a leaf and its inclusion proof
+   *  @param leafHash hash of the leaf, computed with hashLeaf
+   *  @param leafIndex position of the leaf
+   *  @param leafCount number of leaves of the tree
+   *  @param path inclusion proof of the leaf
+   *  @return root hash, or nullptr if @p path is not a valid inclusion proof for
+   *          @p leafIndex in a tree of @p leafCount leaves
+   */
+  static ConstBufferPtr
+  computeRoot(const ConstBufferPtr& leafHash, uint64_t leafIndex, uint64_t leafCount,
+              const std::vector<ConstBufferPtr>& path);
+
+  static ConstBufferPtr
+  hashLeaf(const uint8_t* buf, size_t size);
+
+  static ConstBufferPtr
+  hashChildren(const Buffer& left, const Buffer& right);
+
+private:
+  /// levels of the tree, from the leaf hashes to the root
+  std::vector<std::vector<ConstBufferPtr>> m_levels;
+};
+
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_SECURITY_MERKLE_TREE_HPP
@@ -34,11 +34,42 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <ctime>
+#include <map>
 
 namespace ndn {
 
+namespace {
+
+// CryptoPP::Integer does not expose the memory holding its value, which is needed to lock the
+// pages of a loaded private key.  Access checking does not apply to the names used in an
+// explicit instantiation, so one is used to get a pointer to the private member.
+template<typename Tag, typename Tag::type member>
+struct ExposePrivateMember
+{
+  friend typename Tag::type
+  getPrivateMember(Tag)
+  {
+    return member;
+  }
+};
+
+struct IntegerValue
+{
+  typedef CryptoPP::IntegerSecBlock CryptoPP::Integer::* type;
+
+  friend type
+  getPrivateMember(IntegerValue);
+};
+
+template struct ExposePrivateMember<IntegerValue, &CryptoPP::Integer::reg>;
+
+} // namespace
+
 using std::string;
 using std::ostringstream;
 using std::ofstream;
@@ -91,8 +122,267 @@ public:
     return keyFileName;
   }
 
+  /**
+   * @brief Locks the pages of memory holding private key material, so that they are not
+   *        written to swap.
+   *
+   * mlock() does not nest, so the number of locked buffers on every page is counted, and a page
+   * is unlocked only when none of the buffers is on it anymore.  Locking is best effort: if
+   * mlock() fails (e.g., because of RLIMIT_MEMLOCK), the key is still used.
+   */
+  class PageLocks : ndn::noncopyable
+  {
+  public:
+    PageLocks()
+      : m_pageSize(static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE)))
+    {
+    }
+
+    void
+    lock(const void* buffer, size_t size)
+    {
+      forEachPage(buffer, size, [this] (uintptr_t page) {
+          if (m_nBuffers[page]++ == 0)
+            ::mlock(reinterpret_cast<void*>(page), m_pageSize);
+        });
+    }
+
+    void
+    unlock(const void* buffer, size_t size)
+    {
+      forEachPage(buffer, size, [this] (uintptr_t page) {
+          auto count = m_nBuffers.find(page);
+          if (count != m_nBuffers.end() && --count->second == 0)
+            {
+              ::munlock(reinterpret_cast<void*>(page), m_pageSize);
+              m_nBuffers.erase(count);
+            }
+        });
+    }
+
+  private:
+    template<typename F>
+    void
+    forEachPage(const void* buffer, size_t size, const F& f)
+    {
+      if (size == 0)
+        return;
+
+      uintptr_t first = reinterpret_cast<uintptr_t>(buffer) & ~(m_pageSize - 1);
+      uintptr_t last = (reinterpret_cast<uintptr_t>(buffer) + size - 1) & ~(m_pageSize - 1);
+      for (uintptr_t page = first; page <= last; page += m_pageSize)
+        f(page);
+    }
+
+  private:
+    uintptr_t m_pageSize;
+    std::map<uintptr_t, size_t> m_nBuffers;
+  };
+
+  /**
+   * @brief A private key loaded from the key store, ready to sign.
+   *
+   * The signer owns a copy of the parsed key.  CryptoPP zeroizes its integers when the signer
+   * is destroyed, and the pages holding the private ones are locked while the key is loaded.
+   *
+   * The status and the digest of the .pri file at load time are kept to detect a key that was
+   * deleted or replaced by another SecTpmFile or another process.
+   */
+  class LoadedKey : ndn::noncopyable
+  {
+  public:
+    LoadedKey(PageLocks& pageLocks, KeyType keyType)
+      : keyType(keyType)
+      , isRacy(true)
+      , m_pageLocks(pageLocks)
+    {
+    }
+
+    ~LoadedKey()
+    {
+      // the key material is zeroized before its pages are unlocked
+      signer.reset();
+      for (const auto& buffer : m_lockedBuffers)
+        m_pageLocks.unlock(buffer.first, buffer.second);
+    }
+
+    void
+    lockPrivateInteger(const CryptoPP::Integer& integer)
+    {
+      const CryptoPP::IntegerSecBlock& value = integer.*getPrivateMember(IntegerValue());
+      m_lockedBuffers.push_back({value.begin(), value.size() * sizeof(CryptoPP::word)});
+      m_pageLocks.lock(value.begin(), value.size() * sizeof(CryptoPP::word));
+    }
+
+  public:
+    KeyType keyType;
+    shared_ptr<CryptoPP::PK_Signer> signer;
+
+    struct stat fileStatus;
+    string fileDigest;
+    /// whether the file could change without changing fileStatus (see findLoadedKey)
+    bool isRacy;
+
+  private:
+    PageLocks& m_pageLocks;
+    std::vector<std::pair<const void*, size_t>> m_lockedBuffers;
+  };
+
+  typedef std::map<string, unique_ptr<LoadedKey>> LoadedKeys;
+
+  /**
+   * @brief Loads the private key @p keyURI of type @p keyType from the key store.
+   */
+  LoadedKeys::iterator
+  loadKey(const string& keyURI, KeyType keyType)
+  {
+    using namespace CryptoPP;
+
+    unique_ptr<LoadedKey> key(new LoadedKey(m_pageLocks, keyType));
+
+    // the status is taken before reading, so that a concurrent change is noticed on next use
+    string keyFileName = transformName(keyURI, ".pri").string();
+    if (::stat(keyFileName.c_str(), &key->fileStatus) != 0)
+      BOOST_THROW_EXCEPTION(Error("private key doesn't exist"));
+
+    key->fileDigest = digestOfFile(keyFileName);
+
+    ByteQueue bytes;
+    FileSource file(keyFileName.c_str(), true, new Base64Decoder);
+    file.TransferTo(bytes);
+    bytes.MessageEnd();
+
+    switch (keyType)
+      {
+      case KEY_TYPE_RSA:
+        {
+          RSA::PrivateKey privateKey;
+          privateKey.Load(bytes);
+          auto signer = make_shared<RSASS<PKCS1v15, SHA256>::Signer>(privateKey);
+          key->signer = signer;
+
+          const RSA::PrivateKey& loaded = signer->GetKey();
+          key->lockPrivateInteger(loaded.GetPrime1());
+          key->lockPrivateInteger(loaded.GetPrime2());
+          key->lockPrivateInteger(loaded.GetPrivateExponent());
+          key->lockPrivateInteger(loaded.GetModPrime1PrivateExponent());
+          key->lockPrivateInteger(loaded.GetModPrime2PrivateExponent());
+          key->lockPrivateInteger(loaded.GetMultiplicativeInverseOfPrime2ModPrime1());
+          break;
+        }
+      case KEY_TYPE_ECDSA:
+        {
+          ECDSA<ECP, SHA256>::PrivateKey privateKey;
+          privateKey.Load(bytes);
+          auto signer = make_shared<ECDSA<ECP, SHA256>::Signer>(privateKey);
+          key->signer = signer;
+
+          key->lockPrivateInteger(signer->GetKey().GetPrivateExponent());
+          break;
+        }
+      default:
+        BOOST_THROW_EXCEPTION(Error("Unsupported key type"));
+      }
+
+    unloadKey(keyURI);
+    return m_loadedKeys.insert(std::make_pair(keyURI, std::move(key))).first;
+  }
+
+  /**
+   * @brief Finds the loaded private key @p keyURI.
+   *
+   * The key is dropped, and end() is returned, if its .pri file was removed or modified since
+   * the key was loaded.
+   *
+   * Any change of the file changes its status, except a change made while the file timestamps
+   * still have the value they had when the key was loaded: timestamps have a limited
+   * granularity, and a rewrite of the file in place keeps its inode and, for ECDSA, its size.
+   * Until the file is older than this granularity, its content is compared with the loaded one.
+   */
+  LoadedKeys::iterator
+  findLoadedKey(const string& keyURI)
+  {
+    LoadedKeys::iterator loaded = m_loadedKeys.find(keyURI);
+    if (loaded == m_loadedKeys.end())
+      return loaded;
+
+    LoadedKey& key = *loaded->second;
+    string keyFileName = transformName(keyURI, ".pri").string();
+    struct stat fileStatus;
+    if (::stat(keyFileName.c_str(), &fileStatus) != 0 || !isSameFile(fileStatus, key.fileStatus))
+      {
+        m_loadedKeys.erase(loaded);
+        return m_loadedKeys.end();
+      }
+
+    if (key.isRacy)
+      {
+        // the file is considered settled only if it was not changed for longer than the
+        // timestamp granularity before the content is compared
+        bool isSettled = ::time(nullptr) > fileStatus.st_ctime + 1;
+
+        if (digestOfFile(keyFileName) != key.fileDigest)
+          {
+            m_loadedKeys.erase(loaded);
+            return m_loadedKeys.end();
+          }
+        key.isRacy = !isSettled;
+      }
+    return loaded;
+  }
+
+  /**
+   * @brief Drops the loaded private key @p keyURI, if any.
+   *
+   * Must be called whenever the key pair is deleted or replaced in the key store.
+   */
+  void
+  unloadKey(const string& keyURI)
+  {
+    m_loadedKeys.erase(keyURI);
+  }
+
+private:
+  static bool
+  isSameFile(const struct stat& a, const struct stat& b)
+  {
+#ifdef __APPLE__
+    const struct timespec& aModified = a.st_mtimespec;
+    const struct timespec& bModified = b.st_mtimespec;
+    const struct timespec& aChanged = a.st_ctimespec;
+    const struct timespec& bChanged = b.st_ctimespec;
+#else
+    const struct timespec& aModified = a.st_mtim;
+    const struct timespec& bModified = b.st_mtim;
+    const struct timespec& aChanged = a.st_ctim;
+    const struct timespec& bChanged = b.st_ctim;
+#endif
+
+    return a.st_dev == b.st_dev &&
+           a.st_ino == b.st_ino &&
+           a.st_size == b.st_size &&
+           aModified.tv_sec == bModified.tv_sec && aModified.tv_nsec == bModified.tv_nsec &&
+           aChanged.tv_sec == bChanged.tv_sec && aChanged.tv_nsec == bChanged.tv_nsec;
+  }
+
+  static string
+  digestOfFile(const string& fileName)
+  {
+    using namespace CryptoPP;
+
+    string digest;
+    SHA256 hash;
+    FileSource(fileName.c_str(), true, new HashFilter(hash, new StringSink(digest)));
+    return digest;
+  }
+
 public:
   boost::filesystem::path m_keystorePath;
+
+  PageLocks m_pageLocks;
+  /// private keys that have been used to sign, by key name
+  LoadedKeys m_loadedKeys;
+  CryptoPP::AutoSeededRandomPool m_rng;
 };
 
 
@@ -118,6 +408,7 @@ SecTpmFile::generateKeyPairInTpm(const Name& keyName, const KeyParams& params)
     BOOST_THROW_EXCEPTION(Error("private key exists"));
 
   string keyFileName = m_impl->maintainMapping(keyURI);
+  m_impl->unloadKey(keyURI);
 
   try
     {
@@ -213,6 +504,8 @@ SecTpmFile::deleteKeyPairInTpm(const Name& keyName)
   boost::filesystem::path publicKeyPath(m_impl->transformName(keyName.toUri(), ".pub"));
   boost::filesystem::path privateKeyPath(m_impl->transformName(keyName.toUri(), ".pri"));
 
+  m_impl->unloadKey(keyName.toUri());
+
   if (boost::filesystem::exists(publicKeyPath))
     boost::filesystem::remove(publicKeyPath);
 
@@ -269,6 +562,7 @@ SecTpmFile::importPrivateKeyPkcs8IntoTpm(const Name& keyName, const uint8_t* buf
       using namespace CryptoPP;
 
       string keyFileName = m_impl->maintainMapping(keyName.toUri());
+      m_impl->unloadKey(keyName.toUri());
       keyFileName.append(".pri");
       StringSource(buf, size,
                    true,
@@ -289,6 +583,7 @@ SecTpmFile::importPublicKeyPkcs1IntoTpm(const Name& keyName, const uint8_t* buf,
       using namespace CryptoPP;
 
       string keyFileName = m_impl->maintainMapping(keyName.toUri());
+      m_impl->unloadKey(keyName.toUri());
       keyFileName.append(".pub");
       StringSource(buf, size,
                    true,
@@ -307,84 +602,39 @@ SecTpmFile::signInTpm(const uint8_t* data, size_t dataLength,
 {
   string keyURI = keyName.toUri();
 
-  if (!doesKeyExistInTpm(keyName, KEY_CLASS_PRIVATE))
-    BOOST_THROW_EXCEPTION(Error("private key doesn't exist"));
+  if (digestAlgorithm != DIGEST_ALGORITHM_SHA256)
+    BOOST_THROW_EXCEPTION(Error("Unsupported digest algorithm"));
 
   try
     {
       using namespace CryptoPP;
-      AutoSeededRandomPool rng;
 
-      //Read public key
-      shared_ptr<PublicKey> pubkeyPtr;
-      pubkeyPtr = getPublicKeyFromTpm(keyName);
+      // the key file and the public key are read only when the key is not loaded yet
+      Impl::LoadedKeys::iterator loaded = m_impl->findLoadedKey(keyURI);
+      if (loaded == m_impl->m_loadedKeys.end())
+        {
+          if (!doesKeyExistInTpm(keyName, KEY_CLASS_PRIVATE))
+            BOOST_THROW_EXCEPTION(Error("private key doesn't exist"));
+
+          loaded = m_impl->loadKey(keyURI, getPublicKeyFromTpm(keyName)->getKeyType());
+        }
+      const Impl::LoadedKey& key = *loaded->second;
 
-      switch (pubkeyPtr->getKeyType())
+      SecByteBlock signature(key.signer->MaxSignatureLength());
+      size_t signatureSize = key.signer->SignMessage(m_impl->m_rng, data, dataLength, signature);
+
+      switch (key.keyType)
         {
-          case KEY_TYPE_RSA:
-            {
-              //Read private key
-              ByteQueue bytes;
-              FileSource file(m_impl->transformName(keyURI, ".pri").string().c_str(),
-                              true, new Base64Decoder);
-              file.TransferTo(bytes);
-              bytes.MessageEnd();
-              RSA::PrivateKey privateKey;
-              privateKey.Load(bytes);
-
-              //Sign message
-              switch (digestAlgorithm)
-                {
-                case DIGEST_ALGORITHM_SHA256:
-                  {
-                    RSASS<PKCS1v15, SHA256>::Signer signer(privateKey);
-
-                    OBufferStream os;
-                    StringSource(data, dataLength,
-                                 true,
-                                 new SignerFilter(rng, signer, new FileSink(os)));
-
-                    return Block(tlv::SignatureValue, os.buf());
-                  }
-                default:
-                  BOOST_THROW_EXCEPTION(Error("Unsupported digest algorithm"));
-                }
-            }
+        case KEY_TYPE_RSA:
+          return Block(tlv::SignatureValue, make_shared<Buffer>(signature.begin(), signatureSize));
         case KEY_TYPE_ECDSA:
           {
-            //Read private key
-            ByteQueue bytes;
-            FileSource file(m_impl->transformName(keyURI, ".pri").string().c_str(),
-                            true, new Base64Decoder);
-            file.TransferTo(bytes);
-            bytes.MessageEnd();
-
-            //Sign message
-            switch (digestAlgorithm)
-              {
-              case DIGEST_ALGORITHM_SHA256:
-                {
-                  ECDSA<ECP, SHA256>::PrivateKey privateKey;
-                  privateKey.Load(bytes);
-                  ECDSA<ECP, SHA256>::Signer signer(privateKey);
-
-                  OBufferStream os;
-                  StringSource(data, dataLength,
-                               true,
-                               new SignerFilter(rng, signer, new FileSink(os)));
-
-                  uint8_t buf[200];
-                  size_t bufSize = DSAConvertSignatureFormat(buf, 200, DSA_DER,
-                                                             os.buf()->buf(), os.buf()->size(),
-                                                             DSA_P1363);
-
-                  shared_ptr<Buffer> sigBuffer = make_shared<Buffer>(buf, bufSize);
-
-                  return Block(tlv::SignatureValue, sigBuffer);
-                }
-              default:
-                BOOST_THROW_EXCEPTION(Error("Unsupported digest algorithm"));
-              }
+            uint8_t buf[200];
+            size_t bufSize = DSAConvertSignatureFormat(buf, 200, DSA_DER,
+                                                       signature.begin(), signatureSize,
+                                                       DSA_P1363);
+
+            return Block(tlv::SignatureValue, make_shared<Buffer>(buf, bufSize));
           }
         default:
           BOOST_THROW_EXCEPTION(Error("Unsupported key type"));
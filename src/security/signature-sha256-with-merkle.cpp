@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "signature-sha256-with-merkle.hpp"
+#include "../encoding/block-helpers.hpp"
+#include "../util/crypto.hpp"
+
+namespace ndn {
+
+SignatureSha256WithMerkle::SignatureSha256WithMerkle(const KeyLocator& keyLocator)
+  : Signature(SignatureInfo(tlv::SignatureSha256WithMerkle, keyLocator))
+  , m_leafIndex(0)
+  , m_leafCount(0)
+{
+}
+
+SignatureSha256WithMerkle::SignatureSha256WithMerkle(const Signature& signature)
+  : Signature(signature)
+  , m_leafIndex(0)
+  , m_leafCount(0)
+{
+  if (getType() != tlv::SignatureSha256WithMerkle)
+    BOOST_THROW_EXCEPTION(Error("Incorrect signature type"));
+
+  if (!hasKeyLocator()) {
+    BOOST_THROW_EXCEPTION(Error("KeyLocator is missing"));
+  }
+
+  Block value = getValue();
+  value.parse();
+
+  Block::element_const_iterator element = value.elements_begin();
+  if (element == value.elements_end() || element->type() != tlv::MerkleLeafIndex)
+    BOOST_THROW_EXCEPTION(Error("MerkleLeafIndex is missing"));
+  m_leafIndex = readNonNegativeInteger(*element);
+  ++element;
+
+  if (element == value.elements_end() || element->type() != tlv::MerkleLeafCount)
+    BOOST_THROW_EXCEPTION(Error("MerkleLeafCount is missing"));
+  m_leafCount = readNonNegativeInteger(*element);
+  ++element;
+
+  for (; element != value.elements_end() && element->type() == tlv::MerklePathDigest; ++element) {
+    if (element->value_size() != crypto::SHA256_DIGEST_SIZE)
+      BOOST_THROW_EXCEPTION(Error("MerklePathDigest has incorrect size"));
+    m_path.push_back(make_shared<Buffer>(element->value(), element->value_size()));
+  }
+
+  if (element == value.elements_end() || element->type() != tlv::MerkleRootSignature)
+    BOOST_THROW_EXCEPTION(Error("MerkleRootSignature is missing"));
+  m_rootSignature = makeBinaryBlock(tlv::SignatureValue, element->value(), element->value_size());
+}
+
+Block
+SignatureSha256WithMerkle::encodeValue(uint64_t leafIndex, uint64_t leafCount,
+                                       const std::vector<ConstBufferPtr>& path,
+                                       const Block& rootSignature)
+{
+  Block value(tlv::SignatureValue);
+  value.push_back(makeNonNegativeIntegerBlock(tlv::MerkleLeafIndex, leafIndex));
+  value.push_back(makeNonNegativeIntegerBlock(tlv::MerkleLeafCount, leafCount));
+  for (const ConstBufferPtr& digest : path) {
+    value.push_back(makeBinaryBlock(tlv::MerklePathDigest, digest->buf(), digest->size()));
+  }
+  value.push_back(makeBinaryBlock(tlv::MerkleRootSignature,
+                                  rootSignature.value(), rootSignature.value_size()));
+  value.encode();
+  return value;
+}
+
+void
+SignatureSha256WithMerkle::unsetKeyLocator()
+{
+  BOOST_THROW_EXCEPTION(Error("KeyLocator cannot be reset for SignatureSha256WithMerkle"));
+}
+
+} // namespace ndn
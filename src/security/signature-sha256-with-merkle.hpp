@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_SECURITY_SIGNATURE_SHA256_WITH_MERKLE_HPP
+#define NDN_SECURITY_SIGNATURE_SHA256_WITH_MERKLE_HPP
+
+#include "../signature.hpp"
+#include "../encoding/buffer.hpp"
+
+#include <vector>
+
+namespace ndn {
+
+/**
+ * represents a Sha256WithMerkle signature.
+ *
+ * A batch of packets is signed by building a security::MerkleTree over their signed
+ * portions and signing only the root with an RSA or ECDSA key.  The SignatureValue of
+ * each packet carries the inclusion proof of the packet and the signature of the root:
+ *
+ *     SignatureValue ::= SIGNATURE-VALUE-TYPE TLV-LENGTH
+ *                          MerkleLeafIndex
+ *                          MerkleLeafCount
+ *                          MerklePathDigest*
+ *                          MerkleRootSignature
+ *
+ * The root signature has the format of SignatureSha256WithRsa or SignatureSha256WithEcdsa,
+ * depending on the type of the signing key.
+ */
+class SignatureSha256WithMerkle : public Signature
+{
+public:
+  class Error : public Signature::Error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : Signature::Error(what)
+    {
+    }
+  };
+
+  explicit
+  SignatureSha256WithMerkle(const KeyLocator& keyLocator = KeyLocator());
+
+  /**
+   * @brief Decode the inclusion proof and the root signature from @p signature
+   *
+   * @throw Error @p signature is not a valid Sha256WithMerkle signature
+   */
+  explicit
+  SignatureSha256WithMerkle(const Signature& signature);
+
+  /**
+   * @brief Encode a SignatureValue
+   *
+   * @param leafIndex position of the packet in the batch
+   * @param leafCount number of packets in the batch
+   * @param path inclusion proof of the packet
+   * @param rootSignature SignatureValue block with the signature of the root
+   */
+  static Block
+  encodeValue(uint64_t leafIndex, uint64_t leafCount,
+              const std::vector<ConstBufferPtr>& path, const Block& rootSignature);
+
+  uint64_t
+  getLeafIndex() const
+  {
+    return m_leafIndex;
+  }
+
+  uint64_t
+  getLeafCount() const
+  {
+    return m_leafCount;
+  }
+
+  const std::vector<ConstBufferPtr>&
+  getPath() const
+  {
+    return m_path;
+  }
+
+  /**
+   * @return SignatureValue block with the signature of the root
+   */
+  const Block&
+  getRootSignature() const
+  {
+    return m_rootSignature;
+  }
+
+private:
+  void
+  unsetKeyLocator();
+
+private:
+  uint64_t m_leafIndex;
+  uint64_t m_leafCount;
+  std::vector<ConstBufferPtr> m_path;
+  Block m_rootSignature;
+};
+
+} // namespace ndn
+
+#endif //NDN_SECURITY_SIGNATURE_SHA256_WITH_MERKLE_HPP
@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_SECURITY_SIGNING_CONTEXT_HPP
+#define NDN_SECURITY_SIGNING_CONTEXT_HPP
+
+#include "../name.hpp"
+#include "../signature.hpp"
+#include "security-common.hpp"
+
+namespace ndn {
+namespace security {
+
+class KeyChain;
+
+/**
+ * @brief Signing key and SignatureInfo resolved from a SigningInfo
+ *
+ * KeyChain::prepareSigningContext looks up the signing key and certificate in the PIB and
+ * prepares the SignatureInfo block once.  Signing with the context afterwards does not access
+ * the PIB, so a producer can sign many packets with the same key for the cost of the signature
+ * operations alone.
+ *
+ * A context is not updated when the PIB changes, e.g., when another default identity, key, or
+ * certificate is set by this or another KeyChain.  The holder of a context decides when to
+ * prepare a new one.
+ */
+class SigningContext
+{
+public:
+  /**
+   * @return Name of the signing key, or KeyChain::DIGEST_SHA256_IDENTITY for DigestSha256
+   */
+  const Name&
+  getKeyName() const
+  {
+    return m_keyName;
+  }
+
+  /**
+   * @return Signature holding the prepared SignatureInfo, without SignatureValue
+   */
+  const Signature&
+  getSignature() const
+  {
+    return m_signature;
+  }
+
+  /**
+   * @return The digest algorithm for public key operations
+   */
+  DigestAlgorithm
+  getDigestAlgorithm() const
+  {
+    return m_digestAlgorithm;
+  }
+
+private:
+  SigningContext(const Name& keyName, const SignatureInfo& signatureInfo,
+                 DigestAlgorithm digestAlgorithm)
+    : m_keyName(keyName)
+    , m_signature(signatureInfo)
+    , m_digestAlgorithm(digestAlgorithm)
+  {
+    // encode the SignatureInfo once, its wire is shared by all signed packets
+    m_signature.getInfo();
+  }
+
+  friend class KeyChain;
+
+private:
+  Name m_keyName;
+  Signature m_signature;
+  DigestAlgorithm m_digestAlgorithm;
+};
+
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_SECURITY_SIGNING_CONTEXT_HPP
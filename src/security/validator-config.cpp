@@ -750,6 +750,7 @@ ValidatorConfig::checkSignature(const Packet& packet,
     switch (signature.getType()) {
     case tlv::SignatureSha256WithRsa:
     case tlv::SignatureSha256WithEcdsa:
+    case tlv::SignatureSha256WithMerkle:
       {
         if (!signature.hasKeyLocator()) {
           return onValidationFailed(packet.shared_from_this(),
@@ -25,6 +25,7 @@
 #include "common.hpp"
 
 #include "validator.hpp"
+#include "merkle-tree.hpp"
 #include "../util/crypto.hpp"
 
 #include "cryptopp.hpp"
@@ -91,6 +92,9 @@ Validator::onData(const Interest& interest,
                   const Data& data,
                   const shared_ptr<ValidationRequest>& nextStep)
 {
+  // requests for this certificate from now on start a new fetch
+  m_certificateFetches.erase(interest.getName());
+
   shared_ptr<const Data> certificateData = preCertificateValidation(data);
 
   if (!static_cast<bool>(certificateData))
@@ -227,6 +231,26 @@ Validator::verifySignature(const uint8_t* buf,
                 return false;
               }
           }
+        case tlv::SignatureSha256WithMerkle:
+          {
+            tlv::SignatureTypeValue rootSigType;
+            if (key.getKeyType() == KEY_TYPE_RSA)
+              rootSigType = tlv::SignatureSha256WithRsa;
+            else if (key.getKeyType() == KEY_TYPE_ECDSA)
+              rootSigType = tlv::SignatureSha256WithEcdsa;
+            else
+              return false;
+
+            SignatureSha256WithMerkle merkleSig(sig);
+            ConstBufferPtr root = security::MerkleTree::computeRoot(
+              security::MerkleTree::hashLeaf(buf, size),
+              merkleSig.getLeafIndex(), merkleSig.getLeafCount(), merkleSig.getPath());
+            if (root == nullptr)
+              return false;
+
+            Signature rootSig(SignatureInfo(rootSigType), merkleSig.getRootSignature());
+            return verifySignature(root->buf(), root->size(), rootSig, key);
+          }
         default:
           // Unsupported sig type
           return false;
@@ -236,6 +260,10 @@ Validator::verifySignature(const uint8_t* buf,
     {
       return false;
     }
+  catch (tlv::Error& e)
+    {
+      return false;
+    }
 }
 
 bool
@@ -295,13 +323,71 @@ Validator::afterCheckPolicy(const std::vector<shared_ptr<ValidationRequest> >& n
   for (std::vector<shared_ptr<ValidationRequest> >::const_iterator it = nextSteps.begin();
        it != nextSteps.end(); it++)
     {
-      m_face->expressInterest((*it)->m_interest,
-                              bind(&Validator::onData, this, _1, _2, *it),
+      const Name& certificateName = (*it)->m_interest.getName();
+
+      // wait for the certificate if it is already being fetched
+      std::map<Name, shared_ptr<CertificateWaiters> >::iterator fetch =
+        m_certificateFetches.find(certificateName);
+      if (fetch != m_certificateFetches.end())
+        {
+          fetch->second->push_back(std::make_pair(*it, onFailure));
+          continue;
+        }
+
+      shared_ptr<CertificateWaiters> waiters = make_shared<CertificateWaiters>();
+      waiters->push_back(std::make_pair(*it, onFailure));
+      m_certificateFetches[certificateName] = waiters;
+
+      // the fetch and the validation of the certificate are carried out once, on behalf of
+      // all waiters, with the retries and the number of steps of the first request
+      shared_ptr<ValidationRequest> fetchRequest =
+        make_shared<ValidationRequest>((*it)->m_interest,
+                                       bind(&Validator::onCertificateValidated,
+                                            this, waiters, _1),
+                                       bind(&Validator::onCertificateValidationFailed,
+                                            this, waiters, _1, _2),
+                                       (*it)->m_nRetries, (*it)->m_nSteps);
+      OnFailure onFetchFailure = bind(&Validator::onCertificateFetchFailed,
+                                      this, certificateName, waiters, _1);
+
+      m_face->expressInterest(fetchRequest->m_interest,
+                              bind(&Validator::onData, this, _1, _2, fetchRequest),
                               bind(&Validator::onTimeout,
-                                   this, _1, (*it)->m_nRetries,
-                                   onFailure,
-                                   *it));
+                                   this, _1, fetchRequest->m_nRetries,
+                                   onFetchFailure,
+                                   fetchRequest));
     }
 }
 
+void
+Validator::onCertificateValidated(const shared_ptr<CertificateWaiters>& waiters,
+                                  const shared_ptr<const Data>& certificate)
+{
+  for (CertificateWaiters::const_iterator it = waiters->begin(); it != waiters->end(); ++it)
+    it->first->m_onDataValidated(certificate);
+}
+
+void
+Validator::onCertificateValidationFailed(const shared_ptr<CertificateWaiters>& waiters,
+                                         const shared_ptr<const Data>& certificate,
+                                         const std::string& failureInfo)
+{
+  for (CertificateWaiters::const_iterator it = waiters->begin(); it != waiters->end(); ++it)
+    it->first->m_onDataValidationFailed(certificate, failureInfo);
+}
+
+void
+Validator::onCertificateFetchFailed(const Name& certificateName,
+                                    const shared_ptr<CertificateWaiters>& waiters,
+                                    const std::string& failureInfo)
+{
+  std::map<Name, shared_ptr<CertificateWaiters> >::iterator fetch =
+    m_certificateFetches.find(certificateName);
+  if (fetch != m_certificateFetches.end() && fetch->second == waiters)
+    m_certificateFetches.erase(fetch);
+
+  for (CertificateWaiters::const_iterator it = waiters->begin(); it != waiters->end(); ++it)
+    it->second(failureInfo);
+}
+
 } // namespace ndn
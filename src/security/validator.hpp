@@ -32,6 +32,7 @@
 #include "public-key.hpp"
 #include "signature-sha256-with-rsa.hpp"
 #include "signature-sha256-with-ecdsa.hpp"
+#include "signature-sha256-with-merkle.hpp"
 #include "digest-sha256.hpp"
 #include "validation-request.hpp"
 #include "identity-certificate.hpp"
@@ -304,6 +305,10 @@ protected:
    * Validator can decide how to handle the set of validation requests according to
    * the trust model.
    *
+   * By default, requests for the same certificate name are coalesced: while a certificate is
+   * being fetched, further requests for it wait for that fetch instead of expressing another
+   * Interest, and the retrieved certificate is validated once for all of them.
+   *
    * @param nextSteps A set of validation request made by checkPolicy.
    * @param onFailure Failure callback when errors happen in processing nextSteps.
    */
@@ -311,8 +316,32 @@ protected:
   afterCheckPolicy(const std::vector<shared_ptr<ValidationRequest> >& nextSteps,
                    const OnFailure& onFailure);
 
+private:
+  typedef std::vector<std::pair<shared_ptr<ValidationRequest>, OnFailure> > CertificateWaiters;
+
+  /// @brief Complete all requests waiting for a certificate that has been validated.
+  void
+  onCertificateValidated(const shared_ptr<CertificateWaiters>& waiters,
+                         const shared_ptr<const Data>& certificate);
+
+  /// @brief Fail all requests waiting for a certificate that cannot be validated.
+  void
+  onCertificateValidationFailed(const shared_ptr<CertificateWaiters>& waiters,
+                                const shared_ptr<const Data>& certificate,
+                                const std::string& failureInfo);
+
+  /// @brief Fail all requests waiting for a certificate that cannot be fetched.
+  void
+  onCertificateFetchFailed(const Name& certificateName,
+                           const shared_ptr<CertificateWaiters>& waiters,
+                           const std::string& failureInfo);
+
 protected:
   Face* m_face;
+
+private:
+  /// requests waiting for a certificate being fetched, by the name of the certificate Interest
+  std::map<Name, shared_ptr<CertificateWaiters> > m_certificateFetches;
 };
 
 } // namespace ndn
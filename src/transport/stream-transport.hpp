@@ -211,17 +211,23 @@ public:
   bool
   processAll(uint8_t* buffer, size_t& offset, size_t nBytesAvailable)
   {
-    while (offset < nBytesAvailable) {
-      bool isOk = false;
-      Block element;
-      std::tie(isOk, element) = Block::fromBuffer(buffer + offset, nBytesAvailable - offset);
-      if (!isOk)
-        return false;
-
-      m_transport.receive(element);
-      offset += element.size();
-    }
-    return true;
+    // frame all complete elements in a single pass; each element is copied into its own
+    // buffer, so that a received Block does not keep other packets of the same read alive
+    const uint8_t* begin = buffer + offset;
+    const uint8_t* end = buffer + nBytesAvailable;
+    const uint8_t* framedEnd = tlv::splitElements(begin, end,
+      [&] (uint32_t type, const uint8_t* elementBegin,
+           const uint8_t* valueBegin, const uint8_t* elementEnd) {
+        ConstBufferPtr elementBuffer = make_shared<Buffer>(elementBegin, elementEnd);
+        Block element(elementBuffer, type,
+                      elementBuffer->begin(), elementBuffer->end(),
+                      elementBuffer->begin() + (valueBegin - elementBegin),
+                      elementBuffer->end());
+        m_transport.receive(element);
+        offset += element.size();
+      });
+
+    return framedEnd == end;
   }
 
   void
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "in-memory-storage-arc.hpp"
+
+namespace ndn {
+namespace util {
+
+InMemoryStorageArc::InMemoryStorageArc(size_t limit)
+  : InMemoryStorage(limit)
+  , m_recencyTarget(0)
+{
+}
+
+InMemoryStorageArc::~InMemoryStorageArc()
+{
+}
+
+void
+InMemoryStorageArc::afterInsert(InMemoryStorageEntry* entry)
+{
+  BOOST_ASSERT(m_recent.size() + m_frequent.size() <= size());
+  size_t nPackets = size();
+
+  // a ghost in the recency list means that list was too short, and vice versa
+  GhostIndex::index<byEntity>::type::iterator it = m_recentGhosts.get<byEntity>()
+                                                     .find(entry->getName());
+  if (it != m_recentGhosts.get<byEntity>().end()) {
+    size_t delta = std::max<size_t>(m_frequentGhosts.size() / m_recentGhosts.size(), 1);
+    m_recencyTarget = std::min(m_recencyTarget + delta, nPackets);
+    m_recentGhosts.get<byEntity>().erase(it);
+    m_frequent.insert(entry);
+  }
+  else {
+    it = m_frequentGhosts.get<byEntity>().find(entry->getName());
+    if (it != m_frequentGhosts.get<byEntity>().end()) {
+      size_t delta = std::max<size_t>(m_recentGhosts.size() / m_frequentGhosts.size(), 1);
+      m_recencyTarget = m_recencyTarget > delta ? m_recencyTarget - delta : 0;
+      m_frequentGhosts.get<byEntity>().erase(it);
+      m_frequent.insert(entry);
+    }
+    else {
+      m_recent.insert(entry);
+    }
+  }
+
+  // ghosts are forgotten only here, so that the packet evicted to make room for this one
+  // cannot push out the ghost of this one
+  trimGhosts(nPackets);
+}
+
+bool
+InMemoryStorageArc::evictItem()
+{
+  CleanupIndex* list = &m_frequent;
+  GhostIndex* ghosts = &m_frequentGhosts;
+  if (!m_recent.empty() && (m_recent.size() > m_recencyTarget || m_frequent.empty())) {
+    list = &m_recent;
+    ghosts = &m_recentGhosts;
+  }
+
+  if (list->get<byUsedTime>().empty())
+    return false;
+
+  CleanupIndex::index<byUsedTime>::type::iterator it = list->get<byUsedTime>().begin();
+  Name name = (*it)->getName();
+  eraseImpl((*it)->getFullName());
+  list->get<byUsedTime>().erase(it);
+
+  m_recentGhosts.get<byEntity>().erase(name);
+  m_frequentGhosts.get<byEntity>().erase(name);
+  ghosts->get<byUsedTime>().push_back(name);
+  return true;
+}
+
+void
+InMemoryStorageArc::trimGhosts(size_t nPackets)
+{
+  while (m_recent.size() + m_recentGhosts.size() > nPackets && !m_recentGhosts.empty()) {
+    m_recentGhosts.get<byUsedTime>().pop_front();
+  }
+
+  while (m_recent.size() + m_frequent.size() + m_recentGhosts.size() + m_frequentGhosts.size() >
+         2 * nPackets) {
+    if (!m_frequentGhosts.empty())
+      m_frequentGhosts.get<byUsedTime>().pop_front();
+    else if (!m_recentGhosts.empty())
+      m_recentGhosts.get<byUsedTime>().pop_front();
+    else
+      break;
+  }
+}
+
+void
+InMemoryStorageArc::beforeErase(InMemoryStorageEntry* entry)
+{
+  if (m_recent.get<byEntity>().erase(entry) == 0)
+    m_frequent.get<byEntity>().erase(entry);
+}
+
+void
+InMemoryStorageArc::afterAccess(InMemoryStorageEntry* entry)
+{
+  beforeErase(entry);
+  m_frequent.insert(entry);
+}
+
+} // namespace util
+} // namespace ndn
@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_IN_MEMORY_STORAGE_ARC_HPP
+#define NDN_UTIL_IN_MEMORY_STORAGE_ARC_HPP
+
+#include "in-memory-storage.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+
+namespace ndn {
+namespace util {
+
+/** @brief Provides an in-memory storage with Adaptive Replacement Cache (ARC) policy.
+ *
+ *  Data packets accessed once since insertion are kept in a recency list, and packets accessed
+ *  again move to a frequency list.  Names of packets recently evicted from either list are
+ *  remembered as ghosts; reinserting a ghost shifts the target size of the recency list in its
+ *  favor.  A scan through many packets that are accessed only once therefore evicts packets of
+ *  the recency list only, and leaves frequently accessed packets in place.
+ *
+ *  @sa N. Megiddo, D. S. Modha, "ARC: A Self-Tuning, Low Overhead Replacement Cache",
+ *      FAST 2003
+ */
+class InMemoryStorageArc : public InMemoryStorage
+{
+public:
+  explicit
+  InMemoryStorageArc(size_t limit = 10);
+
+  virtual
+  ~InMemoryStorageArc();
+
+  /** @return{ target number of packets in the recency list }
+   */
+  size_t
+  getRecencyTarget() const
+  {
+    return m_recencyTarget;
+  }
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
+  /** @brief Removes one Data packet from in-memory storage based on ARC, i.e. evict the least
+   *  recently used Data packet of the recency list if it exceeds its target size, otherwise
+   *  that of the frequency list
+   *  @return{ whether the Data was removed }
+   */
+  virtual bool
+  evictItem();
+
+  /** @brief Update the entry when the entry is returned by the find() function,
+   *  move it to the most recently used end of the frequency list
+   */
+  virtual void
+  afterAccess(InMemoryStorageEntry* entry);
+
+  /** @brief Update the entry after a entry is successfully inserted, add it to the frequency
+   *  list if its name is a ghost, otherwise to the recency list
+   */
+  virtual void
+  afterInsert(InMemoryStorageEntry* entry);
+
+  /** @brief Update the entry or other data structures before a entry is successfully erased,
+   *  erase it from its list
+   */
+  virtual void
+  beforeErase(InMemoryStorageEntry* entry);
+
+private:
+  /** @brief Forgets the oldest ghosts so that the recency list and its ghosts hold at most
+   *  @p nPackets names, and all lists and ghosts at most twice as many
+   */
+  void
+  trimGhosts(size_t nPackets);
+
+private:
+  //multi_index_container to implement ARC
+  class byUsedTime;
+  class byEntity;
+
+  typedef boost::multi_index_container<
+    InMemoryStorageEntry*,
+    boost::multi_index::indexed_by<
+
+      // by Entry itself
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byEntity>,
+        boost::multi_index::identity<InMemoryStorageEntry*>
+      >,
+
+      // by last used time
+      boost::multi_index::sequenced<
+        boost::multi_index::tag<byUsedTime>
+      >
+
+    >
+  > CleanupIndex;
+
+  typedef boost::multi_index_container<
+    Name,
+    boost::multi_index::indexed_by<
+
+      // by Name without the implicit digest
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byEntity>,
+        boost::multi_index::identity<Name>,
+        std::hash<Name>
+      >,
+
+      // by eviction time
+      boost::multi_index::sequenced<
+        boost::multi_index::tag<byUsedTime>
+      >
+
+    >
+  > GhostIndex;
+
+  /// packets accessed once since insertion (T1)
+  CleanupIndex m_recent;
+  /// packets accessed more than once (T2)
+  CleanupIndex m_frequent;
+  /// names of packets evicted from m_recent (B1)
+  GhostIndex m_recentGhosts;
+  /// names of packets evicted from m_frequent (B2)
+  GhostIndex m_frequentGhosts;
+  /// target number of packets in m_recent (p)
+  size_t m_recencyTarget;
+};
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_IN_MEMORY_STORAGE_ARC_HPP
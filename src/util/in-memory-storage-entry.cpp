@@ -34,6 +34,8 @@ void
 InMemoryStorageEntry::setData(const Data& data)
 {
   m_dataPacket = data.shared_from_this();
+  m_freshUntil = time::steady_clock::now() + std::max(data.getFreshnessPeriod(),
+                                                      time::milliseconds::zero());
 }
 
 } // namespace util
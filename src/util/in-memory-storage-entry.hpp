@@ -66,13 +66,44 @@ public:
   }
 
 
+  /** @brief Returns the time until which the Data packet is fresh
+   *
+   *  This is the time of setData() plus the FreshnessPeriod of the Data packet.  A Data packet
+   *  without FreshnessPeriod is never fresh.
+   */
+  const time::steady_clock::TimePoint&
+  getFreshUntil() const
+  {
+    return m_freshUntil;
+  }
+
+  /** @brief Checks whether the Data packet is fresh at time @p now
+   */
+  bool
+  isFresh(const time::steady_clock::TimePoint& now) const
+  {
+    return now < m_freshUntil;
+  }
+
+  /** @brief Checks whether the Data packet can satisfy @p interest, including MustBeFresh
+   *  @param now current time, used only if @p interest has MustBeFresh
+   */
+  bool
+  canSatisfy(const Interest& interest, const time::steady_clock::TimePoint& now) const
+  {
+    return (!interest.getMustBeFresh() || isFresh(now)) && interest.matchesData(*m_dataPacket);
+  }
+
   /** @brief Changes the content of in-memory storage entry
+   *
+   *  The Data packet is fresh from now until its FreshnessPeriod elapses.
    */
   void
   setData(const Data& data);
 
 private:
   shared_ptr<const Data> m_dataPacket;
+  time::steady_clock::TimePoint m_freshUntil;
 };
 
 } // namespace util
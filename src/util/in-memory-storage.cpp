@@ -21,6 +21,7 @@
 
 #include "in-memory-storage.hpp"
 #include "in-memory-storage-entry.hpp"
+#include "../name-view.hpp"
 
 #include "crypto.hpp"
 
@@ -86,6 +87,9 @@ InMemoryStorage::const_iterator::operator!=(const const_iterator& rhs)
 InMemoryStorage::InMemoryStorage(size_t limit)
   : m_limit(limit)
   , m_nPackets(0)
+  , m_byteLimit(std::numeric_limits<size_t>::max())
+  , m_nBytes(0)
+  , m_scheduler(nullptr)
 {
   // TODO consider a more suitable initial value
   m_capacity = 10;
@@ -145,13 +149,51 @@ InMemoryStorage::setCapacity(size_t capacity)
   BOOST_ASSERT(size() + m_freeEntries.size() == m_capacity);
 }
 
+void
+InMemoryStorage::setByteLimit(size_t nMaxBytes)
+{
+  m_byteLimit = nMaxBytes;
+
+  while (sizeInBytes() > m_byteLimit) {
+    if (!evictOne()) {
+      BOOST_THROW_EXCEPTION(Error());
+    }
+  }
+
+  if (m_freeEntries.size() > (2 * size() + 1))
+    setCapacity(getCapacity() / 2);
+}
+
 void
 InMemoryStorage::insert(const Data& data)
 {
-  //check if identical Data/Name already exists
-  Cache::index<byFullName>::type::iterator it = m_cache.get<byFullName>().find(data.getFullName());
-  if (it != m_cache.get<byFullName>().end())
+  //if identical Data/Name already exists, it becomes fresh again as if it were just inserted;
+  //the entry is modified through the container to keep the byFreshUntil index ordered
+  Cache::index<byFullNameHash>::type::iterator existing = m_cache.get<byFullNameHash>()
+                                                              .find(data.getFullName());
+  if (existing != m_cache.get<byFullNameHash>().end()) {
+    m_cache.get<byFullNameHash>().modify(existing, [&data] (InMemoryStorageEntry* entry) {
+        entry->setData(data);
+      });
     return;
+  }
+
+  //if the byte limit would be exceeded, evict until the packet fits
+  size_t dataSize = data.wireEncode().size();
+  if (dataSize > m_byteLimit)
+    return;
+
+  if (sizeInBytes() + dataSize > m_byteLimit) {
+    while (sizeInBytes() + dataSize > m_byteLimit) {
+      if (!evictOne())
+        return;
+    }
+
+    //shrink the memory pool to the number of packets that fit into the byte limit,
+    //keeping one entry for the new packet
+    if (m_freeEntries.size() > (2 * size() + 1))
+      setCapacity(getCapacity() / 2);
+  }
 
   //if full, double the capacity
   bool doesReachLimit = (getLimit() == getCapacity());
@@ -161,9 +203,10 @@ InMemoryStorage::insert(const Data& data)
     setCapacity(newCapacity);
   }
 
-  //if full and reach limitation of the capacity, employ replacement policy
+  //if full and reach limitation of the capacity, evict a stale packet if enabled,
+  //otherwise employ replacement policy
   if (isFull() && doesReachLimit) {
-    evictItem();
+    evictOne();
   }
 
   //insert to cache
@@ -172,6 +215,7 @@ InMemoryStorage::insert(const Data& data)
   InMemoryStorageEntry* entry = m_freeEntries.top();
   m_freeEntries.pop();
   m_nPackets++;
+  m_nBytes += dataSize;
   entry->setData(data);
   m_cache.insert(entry);
 
@@ -182,6 +226,24 @@ InMemoryStorage::insert(const Data& data)
 shared_ptr<const Data>
 InMemoryStorage::find(const Name& name)
 {
+  //exact lookups by full name or by name without digest take constant time
+  Cache::index<byFullNameHash>::type::iterator hashIt = m_cache.get<byFullNameHash>().find(name);
+  if (hashIt == m_cache.get<byFullNameHash>().end()) {
+    //the hashed index returns an arbitrary one of several packets with the same name, so it is
+    //used only for a single match; otherwise the ordered lookup below picks the leftmost packet
+    std::pair<Cache::index<byNameHash>::type::iterator,
+              Cache::index<byNameHash>::type::iterator> range =
+      m_cache.get<byNameHash>().equal_range(name);
+    if (range.first != range.second && std::next(range.first) == range.second) {
+      hashIt = m_cache.project<byFullNameHash>(range.first);
+    }
+  }
+  if (hashIt != m_cache.get<byFullNameHash>().end()) {
+    afterAccess(*hashIt);
+    return ((*hashIt)->getData()).shared_from_this();
+  }
+
+  //otherwise, look for the first packet under the given prefix
   Cache::index<byFullName>::type::iterator it = m_cache.get<byFullName>().lower_bound(name);
 
   //if not found, return null
@@ -202,17 +264,41 @@ shared_ptr<const Data>
 InMemoryStorage::find(const Interest& interest)
 {
   //if the interest contains implicit digest, it is possible to directly locate a packet.
-  Cache::index<byFullName>::type::iterator it = m_cache.get<byFullName>()
-                                                    .find(interest.getName());
+  Cache::index<byFullNameHash>::type::iterator hashIt = m_cache.get<byFullNameHash>()
+                                                            .find(interest.getName());
 
-  //if a packet is located by its full name, it must be the packet to return.
-  if (it != m_cache.get<byFullName>().end()) {
-    return ((*it)->getData()).shared_from_this();
+  //if a packet is located by its full name, it must be the packet to return, unless it is stale
+  //and the interest requires fresh data.
+  if (hashIt != m_cache.get<byFullNameHash>().end()) {
+    if (interest.getMustBeFresh() && !(*hashIt)->isFresh(time::steady_clock::now()))
+      return shared_ptr<const Data>();
+
+    return ((*hashIt)->getData()).shared_from_this();
+  }
+
+  //a packet whose name equals the interest's precedes all other packets under that name in
+  //canonical order, so if it is the only such packet and satisfies a leftmost interest, it is
+  //the packet to return.
+  if (interest.getChildSelector() <= 0) {
+    std::pair<Cache::index<byNameHash>::type::iterator,
+              Cache::index<byNameHash>::type::iterator> range =
+      m_cache.get<byNameHash>().equal_range(interest.getName());
+    if (range.first != range.second && std::next(range.first) == range.second) {
+      time::steady_clock::TimePoint now = interest.getMustBeFresh() ?
+                                          time::steady_clock::now() :
+                                          time::steady_clock::TimePoint();
+      if ((*range.first)->canSatisfy(interest, now)) {
+        //let derived class do something with the entry
+        afterAccess(*range.first);
+        return (*range.first)->getData().shared_from_this();
+      }
+    }
   }
 
   //if the packet is not discovered by last step, either the packet is not in the storage or
-  //the interest doesn't contains implicit digest.
-  it = m_cache.get<byFullName>().lower_bound(interest.getName());
+  //the interest requires a selector search in canonical order.
+  Cache::index<byFullName>::type::iterator it = m_cache.get<byFullName>()
+                                                    .lower_bound(interest.getName());
 
   if (it == m_cache.get<byFullName>().end()) {
     return shared_ptr<const Data>();
@@ -248,9 +334,14 @@ InMemoryStorage::selectChild(const Interest& interest,
   bool hasLeftmostSelector = (interest.getChildSelector() <= 0);
   bool hasRightmostSelector = !hasLeftmostSelector;
 
+  // freshness is evaluated against a single point in time
+  time::steady_clock::TimePoint now = interest.getMustBeFresh() ?
+                                      time::steady_clock::now() :
+                                      time::steady_clock::TimePoint();
+
   if (hasLeftmostSelector)
     {
-      if (interest.matchesData((*startingPoint)->getData()))
+      if ((*startingPoint)->canSatisfy(interest, now))
         {
           return *startingPoint;
         }
@@ -261,7 +352,8 @@ InMemoryStorage::selectChild(const Interest& interest,
   if (startingPoint != m_cache.get<byFullName>().end())
     {
       Cache::index<byFullName>::type::iterator rightmostCandidate = startingPoint;
-      Name currentChildPrefix("");
+      // views into the full names of the stored entries, which outlive this loop
+      NameView currentChildPrefix;
 
       while (true)
         {
@@ -276,7 +368,7 @@ InMemoryStorage::selectChild(const Interest& interest,
 
           if (isInPrefix)
             {
-              if (interest.matchesData((*rightmostCandidate)->getData()))
+              if ((*rightmostCandidate)->canSatisfy(interest, now))
                 {
                   if (hasLeftmostSelector)
                     {
@@ -286,8 +378,8 @@ InMemoryStorage::selectChild(const Interest& interest,
                   if (hasRightmostSelector)
                     {
                       // get prefix which is one component longer than Interest name
-                      const Name& childPrefix = (*rightmostCandidate)->getFullName()
-                                                  .getPrefix(interest.getName().size() + 1);
+                      NameView childPrefix = NameView((*rightmostCandidate)->getFullName())
+                                               .getPrefix(interest.getName().size() + 1);
 
                       if (currentChildPrefix.empty() || (childPrefix != currentChildPrefix))
                         {
@@ -309,7 +401,7 @@ InMemoryStorage::selectChild(const Interest& interest,
 
   if (hasRightmostSelector) // if rightmost was not found, try starting point
     {
-      if (interest.matchesData((*startingPoint)->getData()))
+      if ((*startingPoint)->canSatisfy(interest, now))
         {
           return *startingPoint;
         }
@@ -322,6 +414,7 @@ InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
   //push the *empty* entry into mem pool
+  m_nBytes -= (*it)->getData().wireEncode().size();
   (*it)->release();
   m_freeEntries.push(*it);
   m_nPackets--;
@@ -341,29 +434,85 @@ InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
     }
   }
   else {
-    Cache::index<byFullName>::type::iterator it = m_cache.get<byFullName>().find(prefix);
+    Cache::index<byFullNameHash>::type::iterator it = m_cache.get<byFullNameHash>().find(prefix);
 
-    if (it == m_cache.get<byFullName>().end())
+    if (it == m_cache.get<byFullNameHash>().end())
       return;
 
     //let derived class do something with the entry
     beforeErase(*it);
-    freeEntry(it);
+    freeEntry(m_cache.project<byFullName>(it));
   }
 
   if (m_freeEntries.size() > (2 * size()))
     setCapacity(getCapacity() / 2);
 }
 
+size_t
+InMemoryStorage::eraseStale()
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
+  size_t nErased = 0;
+  while (evictStaleItem(now)) {
+    ++nErased;
+  }
+
+  if (nErased > 0 && m_freeEntries.size() > (2 * size()))
+    setCapacity(getCapacity() / 2);
+
+  return nErased;
+}
+
+bool
+InMemoryStorage::evictStaleItem(const time::steady_clock::TimePoint& now)
+{
+  Cache::index<byFreshUntil>::type& index = m_cache.get<byFreshUntil>();
+  if (index.empty() || (*index.begin())->isFresh(now))
+    return false;
+
+  //let derived class do something with the entry
+  beforeErase(*index.begin());
+  freeEntry(m_cache.project<byFullName>(index.begin()));
+  return true;
+}
+
+bool
+InMemoryStorage::evictOne()
+{
+  if (m_scheduler != nullptr && evictStaleItem(time::steady_clock::now()))
+    return true;
+
+  return evictItem();
+}
+
+void
+InMemoryStorage::enableStaleEviction(Scheduler& scheduler, const time::nanoseconds& period)
+{
+  m_scheduler = &scheduler;
+  m_staleEvictionPeriod = period;
+  m_staleEvictionEvent.reset(new scheduler::ScopedEventId(scheduler));
+  scheduleStaleEviction();
+}
+
+void
+InMemoryStorage::scheduleStaleEviction()
+{
+  *m_staleEvictionEvent = m_scheduler->scheduleEvent(m_staleEvictionPeriod, [this] {
+      eraseStale();
+      scheduleStaleEviction();
+    });
+}
+
 void
 InMemoryStorage::eraseImpl(const Name& name)
 {
-  Cache::index<byFullName>::type::iterator it = m_cache.get<byFullName>().find(name);
+  Cache::index<byFullNameHash>::type::iterator it = m_cache.get<byFullNameHash>().find(name);
 
-  if (it == m_cache.get<byFullName>().end())
+  if (it == m_cache.get<byFullNameHash>().end())
     return;
 
-  freeEntry(it);
+  freeEntry(m_cache.project<byFullName>(it));
 }
 
 InMemoryStorage::const_iterator
@@ -27,10 +27,13 @@
 #include "../data.hpp"
 
 #include "in-memory-storage-entry.hpp"
+#include "scheduler.hpp"
+#include "scheduler-scoped-event-id.hpp"
 
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/mem_fun.hpp>
@@ -48,6 +51,9 @@ class InMemoryStorage : noncopyable
 public:
   //multi_index_container to implement storage
   class byFullName;
+  class byFullNameHash;
+  class byNameHash;
+  class byFreshUntil;
 
   typedef boost::multi_index_container<
     InMemoryStorageEntry*,
@@ -59,6 +65,30 @@ public:
         boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
                                           &InMemoryStorageEntry::getFullName>,
         std::less<Name>
+      >,
+
+      // by Full Name, for exact lookups
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byFullNameHash>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getFullName>,
+        std::hash<Name>
+      >,
+
+      // by Name without the implicit digest, for exact lookups
+      boost::multi_index::hashed_non_unique<
+        boost::multi_index::tag<byNameHash>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getName>,
+        std::hash<Name>
+      >,
+
+      // by the time until which the Data is fresh, to locate stale entries
+      boost::multi_index::ordered_non_unique<
+        boost::multi_index::tag<byFreshUntil>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry,
+                                          const time::steady_clock::TimePoint&,
+                                          &InMemoryStorageEntry::getFreshUntil>
       >
 
     >
@@ -122,7 +152,8 @@ public:
    *
    *  @note Packets are considered duplicate if the name with implicit digest matches.
    *  The new Data packet with the identical name, but a different payload
-   *  will be placed in the in-memory storage.
+   *  will be placed in the in-memory storage.  Inserting a duplicate packet makes the stored
+   *  packet fresh again, for the FreshnessPeriod of @p data.
    *
    *  @note It will invoke afterInsert(shared_ptr<InMemoryStorageEntry>).
    */
@@ -130,6 +161,9 @@ public:
   insert(const Data& data);
 
   /** @brief Finds the best match Data for an Interest
+   *
+   *  If the Interest has MustBeFresh, only Data packets whose FreshnessPeriod has not elapsed
+   *  since their insertion can match.
    *
    *  @note It will invoke afterAccess(shared_ptr<InMemoryStorageEntry>).
    *  As currently it is impossible to determine whether a Name contains implicit digest or not,
@@ -168,6 +202,26 @@ public:
   void
   erase(const Name& prefix, const bool isPrefix = true);
 
+  /** @brief Deletes all Data packets that are no longer fresh
+   *
+   *  @note It will invoke beforeErase(shared_ptr<InMemoryStorageEntry>).
+   *  @return{ number of deleted Data packets }
+   */
+  size_t
+  eraseStale();
+
+  /** @brief Enables eviction of stale Data packets
+   *
+   *  Every @p period, eraseStale() is invoked through @p scheduler.  In addition, when the
+   *  in-memory storage is full, a stale Data packet, if any, is evicted before the replacement
+   *  policy is consulted.
+   *
+   *  @param scheduler Scheduler that must outlive the in-memory storage
+   *  @param period    interval between background passes
+   */
+  void
+  enableStaleEviction(Scheduler& scheduler, const time::nanoseconds& period);
+
   /** @return{ maximum number of packets that can be allowed to store in in-memory storage }
    */
   size_t
@@ -176,6 +230,34 @@ public:
     return m_limit;
   }
 
+  /** @brief Limits the total wire encoding size of stored packets
+   *
+   *  The byte limit applies in addition to the packet limit.  When inserting a Data packet
+   *  would exceed it, stale packets (if stale eviction is enabled) and then the packets chosen
+   *  by the replacement policy are evicted until the new packet fits.  A packet that cannot
+   *  fit is not inserted.
+   *
+   *  @throw Error the in-memory storage cannot be reduced to @p nMaxBytes
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
+  /** @return{ maximum total wire encoding size of stored packets, in octets }
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_byteLimit;
+  }
+
+  /** @return{ total wire encoding size of stored packets, in octets }
+   */
+  size_t
+  sizeInBytes() const
+  {
+    return m_nBytes;
+  }
+
   /** @return{ number of packets stored in in-memory storage }
    */
   size_t
@@ -293,6 +375,22 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   selectChild(const Interest& interest,
               Cache::index<byFullName>::type::iterator startingPoint) const;
 
+  /** @brief Deletes the Data packet that became stale first, if it is stale at @p now
+   *  @return{ whether a Data packet was deleted }
+   */
+  bool
+  evictStaleItem(const time::steady_clock::TimePoint& now);
+
+  /** @brief Deletes a stale Data packet if stale eviction is enabled, otherwise one chosen by
+   *  the replacement policy
+   *  @return{ whether a Data packet was deleted }
+   */
+  bool
+  evictOne();
+
+  void
+  scheduleStaleEviction();
+
 private:
   Cache m_cache;
   /// user defined maximum capacity of the in-memory storage in packets
@@ -301,8 +399,17 @@ private:
   size_t m_capacity;
   /// current number of packets in in-memory storage
   size_t m_nPackets;
+  /// user defined maximum total wire encoding size of packets
+  size_t m_byteLimit;
+  /// current total wire encoding size of packets in in-memory storage
+  size_t m_nBytes;
   /// memory pool
   std::stack<InMemoryStorageEntry*> m_freeEntries;
+
+  /// scheduler of the background pass, or nullptr if stale eviction is disabled
+  Scheduler* m_scheduler;
+  time::nanoseconds m_staleEvictionPeriod;
+  unique_ptr<scheduler::ScopedEventId> m_staleEvictionEvent;
 };
 
 } // namespace util
@@ -25,11 +25,58 @@
 
 #include <sstream>
 #include <iomanip>
+#include <cctype>
 
 #include <boost/algorithm/string/trim.hpp>
 
 namespace ndn {
 
+/**
+ * @brief whether an octet may appear in an NDN URI without percent-encoding
+ */
+static const uint8_t URI_UNRESERVED[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/**
+ * @brief value of a hex character, or -1 if not a hex character
+ */
+static const int8_t HEX_VALUE[256] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+  -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+static const char HEX_UPPER[] = "0123456789ABCDEF";
+
 void
 printHex(std::ostream& os, const uint8_t* buffer, size_t length, bool isUpperCase/* = true*/)
 {
@@ -75,14 +122,7 @@ toHex(const Buffer& buffer, bool isUpperCase/* = true*/)
 int
 fromHexChar(uint8_t c)
 {
-  if (c >= '0' && c <= '9')
-    return c - '0';
-  else if (c >= 'A' && c <= 'F')
-    return c - 'A' + 0xA;
-  else if (c >= 'a' && c <= 'f')
-    return c - 'a' + 0xA;
-  else
-    return -1;
+  return HEX_VALUE[c];
 }
 
 shared_ptr<const Buffer>
@@ -124,31 +164,76 @@ trim(std::string& str)
   boost::algorithm::trim(str);
 }
 
+void
+trim(const char*& first, const char*& last)
+{
+  while (first != last && std::isspace(static_cast<unsigned char>(*first)))
+    ++first;
+  while (last != first && std::isspace(static_cast<unsigned char>(last[-1])))
+    --last;
+}
+
+size_t
+escape(const uint8_t* input, size_t inputSize, char* output)
+{
+  char* out = output;
+  for (const uint8_t* in = input; in != input + inputSize; ++in) {
+    if (URI_UNRESERVED[*in]) {
+      *out++ = static_cast<char>(*in);
+    }
+    else {
+      out[0] = '%';
+      out[1] = HEX_UPPER[*in >> 4];
+      out[2] = HEX_UPPER[*in & 0x0F];
+      out += 3;
+    }
+  }
+  return out - output;
+}
+
 std::string
-unescape(const std::string& str)
+escape(const std::string& str)
 {
-  std::ostringstream result;
+  std::string result(str.size() * 3, '\0');
+  result.resize(escape(reinterpret_cast<const uint8_t*>(str.data()), str.size(), &result[0]));
+  return result;
+}
 
-  for (size_t i = 0; i < str.size(); ++i) {
-    if (str[i] == '%' && i + 2 < str.size()) {
-      int hi = fromHexChar(str[i + 1]);
-      int lo = fromHexChar(str[i + 2]);
+size_t
+unescape(const char* input, size_t inputSize, uint8_t* output)
+{
+  uint8_t* out = output;
+  for (size_t i = 0; i < inputSize; ++i) {
+    if (input[i] == '%' && i + 2 < inputSize) {
+      int hi = HEX_VALUE[static_cast<uint8_t>(input[i + 1])];
+      int lo = HEX_VALUE[static_cast<uint8_t>(input[i + 2])];
 
-      if (hi < 0 || lo < 0)
+      if (hi < 0 || lo < 0) {
         // Invalid hex characters, so just keep the escaped string.
-        result << str[i] << str[i + 1] << str[i + 2];
+        out[0] = input[i];
+        out[1] = input[i + 1];
+        out[2] = input[i + 2];
+        out += 3;
+      }
       else
-        result << static_cast<char>((hi << 4) | lo);
+        *out++ = static_cast<uint8_t>((hi << 4) | lo);
 
       // Skip ahead past the escaped value.
       i += 2;
     }
     else
       // Just copy through.
-      result << str[i];
+      *out++ = input[i];
   }
+  return out - output;
+}
 
-  return result.str();
+std::string
+unescape(const std::string& str)
+{
+  std::string result(str.size(), '\0');
+  result.resize(unescape(str.data(), str.size(), reinterpret_cast<uint8_t*>(&result[0])));
+  return result;
 }
 
 } // namespace ndn
@@ -122,6 +122,12 @@ trimRight(std::string& str);
 void
 trim(std::string& str);
 
+/**
+ * @brief Narrow the character range [@p first, @p last) to erase whitespace on the left and right
+ */
+void
+trim(const char*& first, const char*& last);
+
 /**
  * @brief Convert the hex character to an integer from 0 to 15, or -1 if not a hex character
  */
@@ -142,6 +148,44 @@ fromHexChar(uint8_t c);
 std::string
 unescape(const std::string& str);
 
+/**
+ * @brief Percent-encode a sequence of octets into a caller-provided buffer
+ *
+ * Octets other than the unreserved characters of the NDN URI scheme (0-9, A-Z, a-z, '+', '-',
+ * '.' and '_') are encoded as '%' followed by two upper-case hex characters.
+ *
+ * @param input     the octets to encode
+ * @param inputSize number of octets in @p input
+ * @param output    buffer with room for at least 3 * @p inputSize characters
+ * @return number of characters written to @p output (no terminating null character is written)
+ */
+size_t
+escape(const uint8_t* input, size_t inputSize, char* output);
+
+/**
+ * @brief Percent-encode a string
+ * @see escape(const uint8_t*, size_t, char*)
+ *
+ * Examples:
+ *
+ *     escape("hello world") == "hello%20world"
+ */
+std::string
+escape(const std::string& str);
+
+/**
+ * @brief Decode a percent-encoded string into a caller-provided buffer
+ * @see unescape(const std::string&)
+ *
+ * @param input     the characters to decode
+ * @param inputSize number of characters in @p input
+ * @param output    buffer with room for at least @p inputSize octets; it may point to @p input
+ *                  to decode in place
+ * @return number of octets written to @p output
+ */
+size_t
+unescape(const char* input, size_t inputSize, uint8_t* output);
+
 } // namespace ndn
 
 #endif // NDN_STRING_HELPER_HPP
@@ -0,0 +1,367 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_TOKEN_TABLE_HPP
+#define NDN_UTIL_TOKEN_TABLE_HPP
+
+#include "../common.hpp"
+#include "../bead.hpp"
+#include "../data.hpp"
+#include "scheduler.hpp"
+#include "scheduler-scoped-event-id.hpp"
+
+#include <cstring>
+
+namespace ndn {
+namespace util {
+
+/** \brief table that correlates packets carrying the same Token
+ *
+ *  Beads and Data packets carry a Token element.  TokenTable maps token octets to a value of
+ *  type \p T, so that a Bead can be correlated with the Data it chases (or vice versa) with
+ *  a single hash lookup, using the zero-copy Bead::getTokenView and Data::getTokenView.
+ *
+ *  Entries are stored in an open-addressing hash table with linear probing and backward-shift
+ *  deletion.  Every entry expires after a time-to-live.  Expiration is driven by a sweep that
+ *  runs on the supplied Scheduler every quarter of the default time-to-live while the table is
+ *  not empty, so lookups do not need to read the clock; an entry can still be found for up to
+ *  one sweep interval after it has expired.
+ *
+ *  \tparam T type of the value, must be DefaultConstructible and MoveAssignable
+ */
+template<typename T>
+class TokenTable : noncopyable
+{
+public:
+  /** \brief create a table
+   *  \param scheduler scheduler used to reclaim expired entries
+   *  \param ttl default time-to-live of the entries
+   *  \param initialCapacity number of slots initially allocated, rounded up to a power of two
+   */
+  TokenTable(Scheduler& scheduler, const time::nanoseconds& ttl, size_t initialCapacity = 16)
+    : m_scheduler(scheduler)
+    , m_ttl(ttl)
+    , m_size(0)
+    , m_sweepEvent(scheduler)
+    , m_isSweepScheduled(false)
+  {
+    size_t capacity = 1;
+    while (capacity < initialCapacity) {
+      capacity <<= 1;
+    }
+    m_slots.resize(capacity);
+  }
+
+  /** \brief insert or replace the value associated with a token
+   *  \param token pointer to token octets
+   *  \param tokenSize number of token octets
+   *  \param value value to associate with the token
+   *  \param ttl time-to-live of the entry; a negative value selects the default
+   *  \return reference to the stored value, valid until the next insert or erase
+   */
+  T&
+  insert(const uint8_t* token, size_t tokenSize, T value,
+         const time::nanoseconds& ttl = time::nanoseconds(-1))
+  {
+    time::steady_clock::TimePoint expiry = time::steady_clock::now() +
+                                           (ttl < time::nanoseconds::zero() ? m_ttl : ttl);
+    size_t hash = computeHash(token, tokenSize);
+
+    size_t pos = this->findSlot(hash, token, tokenSize);
+    if (pos == NOT_FOUND) {
+      if ((m_size + 1) * 100 > m_slots.size() * MAX_LOAD_FACTOR_PERCENT) {
+        this->rehash(m_slots.size() * 2);
+      }
+
+      pos = hash & this->mask();
+      while (m_slots[pos].isOccupied) {
+        pos = (pos + 1) & this->mask();
+      }
+      m_slots[pos].isOccupied = true;
+      m_slots[pos].hash = hash;
+      m_slots[pos].token.assign(reinterpret_cast<const char*>(token), tokenSize);
+      ++m_size;
+    }
+
+    Slot& slot = m_slots[pos];
+    slot.expiry = expiry;
+    slot.value = std::move(value);
+
+    this->scheduleSweep();
+    return slot.value;
+  }
+
+  /** \brief insert or replace the value associated with a Token block
+   */
+  T&
+  insert(const Block& token, T value, const time::nanoseconds& ttl = time::nanoseconds(-1))
+  {
+    return insert(token.value(), token.value_size(), std::move(value), ttl);
+  }
+
+  /** \brief insert or replace the value associated with the Token of \p bead
+   */
+  T&
+  insert(const Bead& bead, T value, const time::nanoseconds& ttl = time::nanoseconds(-1))
+  {
+    return insert(bead.getTokenView(), std::move(value), ttl);
+  }
+
+  /** \brief insert or replace the value associated with the Token of \p data
+   */
+  T&
+  insert(const Data& data, T value, const time::nanoseconds& ttl = time::nanoseconds(-1))
+  {
+    return insert(data.getTokenView(), std::move(value), ttl);
+  }
+
+  /** \brief find the value associated with a token
+   *  \return pointer to the value, or nullptr if there is no entry for the token
+   */
+  T*
+  find(const uint8_t* token, size_t tokenSize)
+  {
+    size_t pos = this->findSlot(computeHash(token, tokenSize), token, tokenSize);
+    if (pos == NOT_FOUND)
+      return nullptr;
+
+    return &m_slots[pos].value;
+  }
+
+  T*
+  find(const Block& token)
+  {
+    return find(token.value(), token.value_size());
+  }
+
+  T*
+  find(const Bead& bead)
+  {
+    return find(bead.getTokenView());
+  }
+
+  T*
+  find(const Data& data)
+  {
+    return find(data.getTokenView());
+  }
+
+  /** \brief erase the entry associated with a token
+   *  \return whether an entry was erased
+   */
+  bool
+  erase(const uint8_t* token, size_t tokenSize)
+  {
+    size_t pos = this->findSlot(computeHash(token, tokenSize), token, tokenSize);
+    if (pos == NOT_FOUND)
+      return false;
+
+    this->eraseSlot(pos);
+    return true;
+  }
+
+  bool
+  erase(const Block& token)
+  {
+    return erase(token.value(), token.value_size());
+  }
+
+  /** \brief erase all entries
+   */
+  void
+  clear()
+  {
+    for (Slot& slot : m_slots) {
+      slot = Slot();
+    }
+    m_size = 0;
+    m_sweepEvent.cancel();
+    m_isSweepScheduled = false;
+  }
+
+  /** \return number of entries, including expired entries that have not been swept yet
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /** \return number of allocated slots
+   */
+  size_t
+  capacity() const
+  {
+    return m_slots.size();
+  }
+
+  /** \brief erase all expired entries
+   *
+   *  This is invoked by the periodic sweep.
+   */
+  void
+  removeExpiredEntries()
+  {
+    time::steady_clock::TimePoint now = time::steady_clock::now();
+    for (size_t pos = 0; pos < m_slots.size(); ) {
+      // eraseSlot may shift another entry into pos, so pos is checked again
+      if (m_slots[pos].isOccupied && m_slots[pos].expiry <= now) {
+        this->eraseSlot(pos);
+      }
+      else {
+        ++pos;
+      }
+    }
+  }
+
+private:
+  struct Slot
+  {
+    Slot()
+      : isOccupied(false)
+      , hash(0)
+    {
+    }
+
+    bool isOccupied;
+    size_t hash;
+    std::string token;
+    time::steady_clock::TimePoint expiry;
+    T value;
+  };
+
+  static size_t
+  computeHash(const uint8_t* token, size_t tokenSize)
+  {
+    // tokens are hashed a word at a time, which is several times faster than
+    // boost::hash_range for typical token lengths
+    const uint64_t MULTIPLIER = 0x9e3779b97f4a7c15ULL;
+    uint64_t hash = tokenSize * MULTIPLIER;
+    uint64_t word = 0;
+    for (; tokenSize >= sizeof(word); token += sizeof(word), tokenSize -= sizeof(word)) {
+      std::memcpy(&word, token, sizeof(word));
+      hash = (hash ^ word) * MULTIPLIER;
+      hash ^= hash >> 29;
+    }
+    if (tokenSize > 0) {
+      word = 0;
+      std::memcpy(&word, token, tokenSize);
+      hash = (hash ^ word) * MULTIPLIER;
+      hash ^= hash >> 29;
+    }
+    return static_cast<size_t>(hash ^ (hash >> 32));
+  }
+
+  size_t
+  mask() const
+  {
+    return m_slots.size() - 1;
+  }
+
+  size_t
+  findSlot(size_t hash, const uint8_t* token, size_t tokenSize) const
+  {
+    for (size_t pos = hash & this->mask(); m_slots[pos].isOccupied; pos = (pos + 1) & this->mask()) {
+      const Slot& slot = m_slots[pos];
+      if (slot.hash == hash && slot.token.size() == tokenSize &&
+          std::equal(token, token + tokenSize, reinterpret_cast<const uint8_t*>(slot.token.data()))) {
+        return pos;
+      }
+    }
+    return NOT_FOUND;
+  }
+
+  void
+  eraseSlot(size_t pos)
+  {
+    // backward-shift deletion: move following entries of the probe sequence into the hole,
+    // unless their home slot lies cyclically in (hole, current]
+    size_t hole = pos;
+    for (size_t next = (hole + 1) & this->mask(); m_slots[next].isOccupied;
+         next = (next + 1) & this->mask()) {
+      size_t home = m_slots[next].hash & this->mask();
+      bool isHomeInRange = hole <= next ? (hole < home && home <= next)
+                                        : (hole < home || home <= next);
+      if (!isHomeInRange) {
+        m_slots[hole] = std::move(m_slots[next]);
+        hole = next;
+      }
+    }
+    m_slots[hole] = Slot();
+    --m_size;
+  }
+
+  void
+  rehash(size_t newCapacity)
+  {
+    std::vector<Slot> oldSlots(newCapacity);
+    m_slots.swap(oldSlots);
+
+    for (Slot& slot : oldSlots) {
+      if (!slot.isOccupied)
+        continue;
+
+      size_t pos = slot.hash & this->mask();
+      while (m_slots[pos].isOccupied) {
+        pos = (pos + 1) & this->mask();
+      }
+      m_slots[pos] = std::move(slot);
+    }
+  }
+
+  void
+  scheduleSweep()
+  {
+    if (m_isSweepScheduled)
+      return;
+
+    m_isSweepScheduled = true;
+    m_sweepEvent = m_scheduler.scheduleEvent(m_ttl / 4, [this] {
+        m_isSweepScheduled = false;
+        this->removeExpiredEntries();
+        if (m_size > 0) {
+          this->scheduleSweep();
+        }
+      });
+  }
+
+private:
+  static const size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+  static const size_t MAX_LOAD_FACTOR_PERCENT = 70;
+
+  Scheduler& m_scheduler;
+  time::nanoseconds m_ttl;
+  std::vector<Slot> m_slots;
+  size_t m_size;
+  scheduler::ScopedEventId m_sweepEvent;
+  bool m_isSweepScheduled;
+};
+
+template<typename T>
+const size_t TokenTable<T>::NOT_FOUND;
+
+template<typename T>
+const size_t TokenTable<T>::MAX_LOAD_FACTOR_PERCENT;
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_TOKEN_TABLE_HPP
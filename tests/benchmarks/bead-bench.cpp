@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "bead.hpp"
+#include "link.hpp"
+#include "security/digest-sha256.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+#include "allocation-counter.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchBead)
+
+static const size_t N_ITERATIONS = 200000;
+
+static Block
+makeLinkWire()
+{
+  Link link("/bench/link", {{10, Name("/local")}, {20, Name("/ndn/edu/ucla")}});
+  Signature signature(SignatureInfo(tlv::DigestSha256));
+  signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+  link.setSignature(signature);
+  return link.wireEncode();
+}
+
+static void
+printResult(const std::string& variant, const std::string& operation,
+            const time::nanoseconds& duration, uint64_t nAllocations)
+{
+  std::cout << std::setw(24) << variant << " " << std::setw(12) << operation << ": "
+            << std::setw(6) << duration.count() / N_ITERATIONS << " ns/op, "
+            << std::setw(5) << static_cast<double>(nAllocations) / N_ITERATIONS << " allocs/op"
+            << std::endl;
+}
+
+// Encoding and decoding Beads with and without Link, Selectors, Token and Hops
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  Name name = Name("/bench/bead/encode/decode").appendSegment(7);
+  Block linkWire = makeLinkWire();
+
+  std::vector<std::pair<std::string, Bead>> variants;
+  {
+    Bead bead(name);
+    variants.push_back(std::make_pair("name only", bead));
+
+    bead.setHops(12);
+    variants.push_back(std::make_pair("hops", bead));
+
+    bead.setToken("deletion-token-0123456789");
+    variants.push_back(std::make_pair("hops+token", bead));
+
+    bead.setMustBeFresh(true);
+    bead.setExclude(Exclude().excludeOne(name::Component("excluded")));
+    variants.push_back(std::make_pair("hops+token+selectors", bead));
+
+    bead.setLink(linkWire);
+    bead.setSelectedDelegation(1);
+    variants.push_back(std::make_pair("all+link", bead));
+  }
+
+  for (auto& variant : variants) {
+    Bead& bead = variant.second;
+    bead.setNonce(1);
+
+    uint64_t nAllocations = 0;
+    time::nanoseconds encode = timedExecute([&] {
+      nAllocations = countAllocations([&] {
+        for (size_t i = 0; i < N_ITERATIONS; ++i) {
+          EncodingEstimator estimator;
+          size_t estimatedSize = bead.wireEncode(estimator);
+          EncodingBuffer buffer(estimatedSize, 0);
+          bead.wireEncode(buffer);
+        }
+      });
+    });
+    printResult(variant.first, "encode", encode, nAllocations);
+
+    const Block& wire = bead.wireEncode();
+    for (Bead::DecodeMode mode : {Bead::DECODE_EAGER, Bead::DECODE_LAZY}) {
+      time::nanoseconds decode = timedExecute([&] {
+        nAllocations = countAllocations([&] {
+          for (size_t i = 0; i < N_ITERATIONS; ++i) {
+            // decode from a fresh Block each time, because Block::parse is cached
+            Bead decoded(Block(wire.getBuffer(), wire.begin(), wire.end()), mode);
+            BOOST_ASSERT(decoded.getHops() == bead.getHops());
+          }
+        });
+      });
+      printResult(variant.first, mode == Bead::DECODE_EAGER ? "decode" : "lazy decode",
+                  decode, nAllocations);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
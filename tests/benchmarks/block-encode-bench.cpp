@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "encoding/block.hpp"
+#include "encoding/block-helpers.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+#include "allocation-counter.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchBlockEncode)
+
+static const size_t N_ITERATIONS = 500000;
+
+// Block::encode of a Name element with 20 components, and of a nested element
+BOOST_AUTO_TEST_CASE(EncodeName)
+{
+  Block name(tlv::Name);
+  for (int i = 0; i < 20; ++i) {
+    name.push_back(makeStringBlock(tlv::NameComponent, "component-" + std::to_string(i)));
+  }
+
+  Block outer(tlv::Data);
+  outer.push_back(name);
+  outer.push_back(makeNonNegativeIntegerBlock(tlv::FreshnessPeriod, 1000));
+
+  for (Block* block : {&name, &outer}) {
+    uint64_t nAllocations = 0;
+    time::nanoseconds duration = timedExecute([&] {
+      nAllocations = countAllocations([&] {
+        for (size_t i = 0; i < N_ITERATIONS; ++i) {
+          block->resetWire();
+          block->encode();
+        }
+      });
+    });
+    BOOST_CHECK(block->hasWire());
+
+    std::cout << std::setw(24) << (block == &name ? "Name (20 components)" : "Data containing Name")
+              << ": " << std::setw(6) << duration.count() / N_ITERATIONS << " ns/encode, "
+              << std::setw(5) << static_cast<double>(nAllocations) / N_ITERATIONS << " allocs/encode"
+              << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
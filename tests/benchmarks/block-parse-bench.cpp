@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "data.hpp"
+#include "security/digest-sha256.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+#include "allocation-counter.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchBlockParse)
+
+static const size_t N_ITERATIONS = 200000;
+
+// Heap allocations and time per fully decoded Data, for names of increasing length
+BOOST_AUTO_TEST_CASE(DecodeData)
+{
+  for (size_t nComponents : {2, 8, 20}) {
+    Name name;
+    for (size_t i = 0; i < nComponents; ++i)
+      name.appendNumber(i);
+
+    Data data(name);
+    data.setFreshnessPeriod(time::seconds(10));
+    static const uint8_t CONTENT[256] = {};
+    data.setContent(CONTENT, sizeof(CONTENT));
+    Signature signature(SignatureInfo(tlv::DigestSha256));
+    signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+    data.setSignature(signature);
+    const Block& wire = data.wireEncode();
+
+    uint64_t nAllocations = 0;
+    uint64_t checksum = 0;
+    time::nanoseconds duration = timedExecute([&] {
+      nAllocations = countAllocations([&] {
+        for (size_t i = 0; i < N_ITERATIONS; ++i) {
+          Data decoded(Block(wire.getBuffer(), wire.begin(), wire.end()));
+          checksum += decoded.getName().size() + decoded.getContent().value_size();
+        }
+      });
+    });
+    BOOST_CHECK_GT(checksum, 0);
+
+    std::cout << std::setw(3) << nComponents << " components: "
+              << std::setw(6) << duration.count() / N_ITERATIONS << " ns/Data, "
+              << std::setw(6) << static_cast<double>(nAllocations) / N_ITERATIONS
+              << " allocs/Data" << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "compact-name.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+#include "allocation-counter.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchCompactName)
+
+static const size_t N_ITERATIONS = 100000;
+
+template<typename F>
+static void
+measure(const std::string& what, size_t nComponents, const F& f)
+{
+  uint64_t nAllocations = 0;
+  time::nanoseconds duration = timedExecute([&] {
+    nAllocations = countAllocations(f);
+  });
+
+  std::cout << std::setw(24) << what << " (" << nComponents << " components): "
+            << std::setw(6) << duration.count() / N_ITERATIONS << " ns/op, "
+            << std::setw(5) << static_cast<double>(nAllocations) / N_ITERATIONS << " allocs/op"
+            << std::endl;
+}
+
+// decoding a received name, then copying it into a table, comparing it and visiting its components
+BOOST_AUTO_TEST_CASE(DecodeCopyIterate)
+{
+  for (size_t nComponents : {4, 8}) {
+    Name name;
+    for (size_t i = 0; i < nComponents; ++i)
+      name.append(name::Component("component-" + std::to_string(i)));
+    Block wire = name.wireEncode();
+    Name otherName(name);
+    CompactName otherCompact(name);
+
+    size_t checksum = 0;
+
+    measure("Name decode", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        Name decoded(wire);
+        checksum += decoded.size();
+      }
+    });
+    measure("CompactName decode", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        CompactName decoded(wire);
+        checksum += decoded.size();
+      }
+    });
+
+    measure("Name copy", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        Name copy(otherName);
+        checksum += copy.size();
+      }
+    });
+    measure("CompactName copy", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        CompactName copy(otherCompact);
+        checksum += copy.size();
+      }
+    });
+
+    Name decodedName(wire);
+    CompactName decodedCompact(wire);
+    measure("Name ==", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        checksum += decodedName == otherName;
+      }
+    });
+    measure("CompactName ==", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        checksum += decodedCompact == otherCompact;
+      }
+    });
+
+    measure("Name iterate", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        for (const name::Component& component : decodedName)
+          checksum += component.value_size();
+      }
+    });
+    measure("CompactName iterate", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        for (const name::Component& component : decodedCompact)
+          checksum += component.value_size();
+      }
+    });
+
+    measure("Name wireEncode", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        checksum += decodedName.wireEncode().size();
+      }
+    });
+    measure("CompactName wireEncode", nComponents, [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        checksum += decodedCompact.wireEncode().size();
+      }
+    });
+
+    BOOST_CHECK_NE(checksum, 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
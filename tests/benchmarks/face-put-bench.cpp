@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "util/scheduler.hpp"
+#include "bead.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchFacePut)
+
+// Compares the scheduling pattern of Face::putBead (one zero-delay event per packet)
+// with Face::putBeads (one zero-delay event per burst)
+BOOST_AUTO_TEST_CASE(BeadBursts)
+{
+  const size_t N_BEADS = 100000;
+
+  boost::asio::io_service io;
+  util::Scheduler scheduler(io);
+
+  std::vector<shared_ptr<const Bead>> beads;
+  for (size_t i = 0; i < N_BEADS; ++i) {
+    beads.push_back(make_shared<Bead>(Name("/bench/bead").appendNumber(i)));
+  }
+
+  size_t nDelivered = 0;
+  size_t nInOrder = 0;
+  auto deliver = [&] (const shared_ptr<const Bead>& bead) {
+    if (bead == beads[nDelivered])
+      ++nInOrder;
+    ++nDelivered;
+  };
+
+  for (size_t burstSize : {1, 10, 100, 1000}) {
+    size_t nEvents = 0;
+    nDelivered = nInOrder = 0;
+    time::nanoseconds perPacket = timedExecute([&] {
+      for (const auto& bead : beads) {
+        scheduler.scheduleEvent(time::seconds(0), [=] { deliver(bead); });
+        ++nEvents;
+      }
+      ns3::Simulator::Run();
+    });
+    BOOST_CHECK_EQUAL(nDelivered, N_BEADS);
+    BOOST_CHECK_EQUAL(nInOrder, N_BEADS);
+    size_t nPerPacketEvents = nEvents;
+
+    nEvents = 0;
+    nDelivered = nInOrder = 0;
+    time::nanoseconds batched = timedExecute([&] {
+      for (size_t i = 0; i < N_BEADS; i += burstSize) {
+        auto burst = make_shared<std::vector<shared_ptr<const Bead>>>(
+                       beads.begin() + i, beads.begin() + std::min(i + burstSize, N_BEADS));
+        scheduler.scheduleEvent(time::seconds(0), [=] {
+            for (const auto& bead : *burst) {
+              deliver(bead);
+            }
+          });
+        ++nEvents;
+      }
+      ns3::Simulator::Run();
+    });
+    BOOST_CHECK_EQUAL(nDelivered, N_BEADS);
+    BOOST_CHECK_EQUAL(nInOrder, N_BEADS);
+    BOOST_CHECK_EQUAL(nEvents, (N_BEADS + burstSize - 1) / burstSize);
+
+    std::cout << "burst " << std::setw(4) << burstSize << ": "
+              << "per-packet " << nPerPacketEvents << " events, "
+              << perPacket.count() / N_BEADS << " ns/Bead; "
+              << "batched " << nEvents << " events, "
+              << batched.count() / N_BEADS << " ns/Bead" << std::endl;
+  }
+
+  ns3::Simulator::Destroy();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,352 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "util/in-memory-storage-persistent.hpp"
+#include "util/in-memory-storage-fifo.hpp"
+#include "util/in-memory-storage-lfu.hpp"
+#include "util/in-memory-storage-lru.hpp"
+#include "util/in-memory-storage-arc.hpp"
+#include "util/time-unit-test-clock.hpp"
+#include "security/digest-sha256.hpp"
+#include "ns3/simulator.h"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchInMemoryStorage)
+
+/** \brief draws content indexes in [0, n) with Zipf-distributed popularity
+ */
+class ZipfGenerator
+{
+public:
+  ZipfGenerator(size_t n, double alpha, uint32_t seed)
+    : m_engine(seed)
+  {
+    double sum = 0;
+    for (size_t i = 1; i <= n; ++i) {
+      sum += 1.0 / std::pow(static_cast<double>(i), alpha);
+      m_cdf.push_back(sum);
+    }
+    for (double& p : m_cdf) {
+      p /= sum;
+    }
+  }
+
+  size_t
+  operator()()
+  {
+    double u = m_uniform(m_engine);
+    return std::min<size_t>(std::lower_bound(m_cdf.begin(), m_cdf.end(), u) - m_cdf.begin(),
+                            m_cdf.size() - 1);
+  }
+
+private:
+  std::mt19937 m_engine;
+  std::uniform_real_distribution<double> m_uniform;
+  std::vector<double> m_cdf;
+};
+
+enum Mode {
+  IGNORE_FRESHNESS, ///< Interests without MustBeFresh, as every lookup behaved before
+  MUST_BE_FRESH,    ///< MustBeFresh Interests
+  EVICT_STALE       ///< MustBeFresh Interests, with stale Data evicted first
+};
+
+// A producer behind a 1000-entry LRU storage serves 10000 contents with Zipf(0.8) popularity.
+// A request arrives every 100us; every content has a FreshnessPeriod of 1s, and a miss makes
+// the producer insert a new version.
+BOOST_AUTO_TEST_CASE(ZipfHitRate)
+{
+  const size_t N_CONTENTS = 10000;
+  const size_t N_REQUESTS = 200000;
+  const size_t CAPACITY = 1000;
+  const time::nanoseconds INTER_ARRIVAL = time::microseconds(100);
+
+  auto steadyClock = make_shared<time::UnitTestSteadyClock>();
+  time::setCustomClocks(steadyClock, nullptr);
+  boost::asio::io_service io;
+  util::Scheduler scheduler(io);
+
+  std::vector<Name> names;
+  for (size_t i = 0; i < N_CONTENTS; ++i) {
+    names.push_back(Name("/bench/ims/content").appendNumber(i));
+  }
+
+  for (Mode mode : {IGNORE_FRESHNESS, MUST_BE_FRESH, EVICT_STALE}) {
+    util::InMemoryStorageLru ims(CAPACITY);
+    if (mode == EVICT_STALE) {
+      ims.enableStaleEviction(scheduler, time::seconds(1));
+    }
+
+    ZipfGenerator zipf(N_CONTENTS, 0.8, 20151201);
+    std::vector<uint32_t> versions(N_CONTENTS, 0);
+    std::vector<time::steady_clock::TimePoint> expiries(N_CONTENTS);
+    size_t nFreshHits = 0;
+    size_t nStaleHits = 0;
+    time::steady_clock::TimePoint lastPass = time::steady_clock::now();
+
+    time::nanoseconds duration = timedExecute([&] {
+      for (size_t i = 0; i < N_REQUESTS; ++i) {
+        steadyClock->advance(INTER_ARRIVAL);
+        if (time::steady_clock::now() - lastPass >= time::seconds(1)) {
+          // let the simulator catch up, which runs the scheduled stale eviction pass if enabled
+          ns3::Simulator::Stop(ns3::Seconds(1));
+          ns3::Simulator::Run();
+          lastPass = time::steady_clock::now();
+        }
+
+        size_t index = zipf();
+        Interest interest(names[index]);
+        interest.setMustBeFresh(mode != IGNORE_FRESHNESS);
+
+        shared_ptr<const Data> found = ims.find(interest);
+        if (found != nullptr) {
+          bool isFresh = readNonNegativeInteger(found->getContent()) == versions[index] &&
+                         time::steady_clock::now() < expiries[index];
+          // stale Data is served to the consumer as well, which is what MustBeFresh prevents
+          ++(isFresh ? nFreshHits : nStaleHits);
+          continue;
+        }
+
+        // the producer makes a new version
+        expiries[index] = time::steady_clock::now() + time::seconds(1);
+        shared_ptr<Data> data = make_shared<Data>(names[index]);
+        data->setFreshnessPeriod(time::seconds(1));
+        data->setContent(makeNonNegativeIntegerBlock(tlv::Content, ++versions[index]));
+        Signature signature(SignatureInfo(tlv::DigestSha256));
+        signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+        data->setSignature(signature);
+        data->wireEncode();
+        ims.insert(*data);
+      }
+    });
+
+    std::cout << std::setw(18)
+              << (mode == IGNORE_FRESHNESS ? "ignore freshness" :
+                  mode == MUST_BE_FRESH ? "MustBeFresh" : "MustBeFresh+evict")
+              << ": fresh hits " << std::setw(5) << std::fixed << std::setprecision(1)
+              << 100.0 * nFreshHits / N_REQUESTS << "%, stale hits "
+              << std::setw(5) << 100.0 * nStaleHits / N_REQUESTS << "%, "
+              << std::setw(5) << duration.count() / N_REQUESTS << " ns/request" << std::endl;
+
+    if (mode != IGNORE_FRESHNESS) {
+      BOOST_CHECK_EQUAL(nStaleHits, 0);
+    }
+  }
+
+  ns3::Simulator::Destroy();
+  time::setCustomClocks(nullptr, nullptr);
+}
+
+/** \brief replays a trace of content indexes against \p ims, inserting the Data on a miss
+ */
+void
+replayTrace(util::InMemoryStorage& ims, const std::string& policy,
+            const std::vector<size_t>& trace, const std::vector<shared_ptr<Data>>& packets)
+{
+  size_t nHits = 0;
+  time::nanoseconds duration = timedExecute([&] {
+    for (size_t index : trace) {
+      if (ims.find(Interest(packets[index]->getName())) != nullptr) {
+        ++nHits;
+      }
+      else {
+        ims.insert(*packets[index]);
+      }
+    }
+  });
+
+  std::cout << std::setw(12) << policy << ": hits " << std::setw(5) << std::fixed
+            << std::setprecision(1) << 100.0 * nHits / trace.size() << "%, "
+            << std::setw(5) << duration.count() / trace.size() << " ns/request" << std::endl;
+}
+
+// Hit rates of the replacement policies with a 1000-entry storage on synthetic traces over
+// 10000 contents:
+//  - Zipf(0.8) popularity;
+//  - the same, with a third of the requests walking segments of objects that are fetched once;
+//  - Zipf(0.8) popularity whose ranking changes halfway through the trace.
+// The persistent storage is unbounded and gives the hit rate of an infinite storage.
+BOOST_AUTO_TEST_CASE(PolicyHitRate)
+{
+  const size_t N_CONTENTS = 10000;
+  const size_t N_REQUESTS = 200000;
+  const size_t CAPACITY = 1000;
+
+  std::vector<shared_ptr<Data>> packets;
+  auto makePacket = [&packets] (const Name& name) {
+    shared_ptr<Data> data = make_shared<Data>(name);
+    Signature signature(SignatureInfo(tlv::DigestSha256));
+    signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+    data->setSignature(signature);
+    data->wireEncode();
+    data->getFullName();
+    packets.push_back(data);
+    return packets.size() - 1;
+  };
+  for (size_t i = 0; i < N_CONTENTS; ++i) {
+    makePacket(Name("/bench/ims/content").appendNumber(i));
+  }
+
+  std::vector<std::pair<std::string, std::vector<size_t>>> traces;
+
+  ZipfGenerator zipf(N_CONTENTS, 0.8, 20151203);
+  traces.push_back({"Zipf", {}});
+  for (size_t i = 0; i < N_REQUESTS; ++i) {
+    traces.back().second.push_back(zipf());
+  }
+
+  std::mt19937 engine(20151203);
+  std::bernoulli_distribution isScan(1.0 / 3);
+  traces.push_back({"Zipf with scans", {}});
+  for (size_t i = 0, segment = 0; i < N_REQUESTS; ++i) {
+    if (isScan(engine)) {
+      traces.back().second.push_back(makePacket(Name("/bench/ims/object")
+                                                  .appendNumber(segment / 100)
+                                                  .appendSegment(segment % 100)));
+      ++segment;
+    }
+    else {
+      traces.back().second.push_back(zipf());
+    }
+  }
+
+  traces.push_back({"shifting Zipf", {}});
+  for (size_t i = 0; i < N_REQUESTS; ++i) {
+    size_t rank = zipf();
+    if (i >= N_REQUESTS / 2) {
+      rank = (rank + N_CONTENTS / 2) % N_CONTENTS;
+    }
+    traces.back().second.push_back(rank);
+  }
+
+  for (const auto& trace : traces) {
+    std::cout << trace.first << std::endl;
+    {
+      util::InMemoryStoragePersistent ims;
+      replayTrace(ims, "Persistent", trace.second, packets);
+    }
+    {
+      util::InMemoryStorageFifo ims(CAPACITY);
+      replayTrace(ims, "FIFO", trace.second, packets);
+    }
+    {
+      util::InMemoryStorageLfu ims(CAPACITY);
+      replayTrace(ims, "LFU", trace.second, packets);
+    }
+    {
+      util::InMemoryStorageLru ims(CAPACITY);
+      replayTrace(ims, "LRU", trace.second, packets);
+    }
+    {
+      util::InMemoryStorageArc ims(CAPACITY);
+      replayTrace(ims, "ARC", trace.second, packets);
+    }
+  }
+}
+
+// Lookups in a storage of 1M Data packets
+BOOST_AUTO_TEST_CASE(Lookup1M)
+{
+  const size_t N_ENTRIES = 1000000;
+  const size_t N_LOOKUPS = 1000000;
+
+  std::vector<shared_ptr<Data>> packets;
+  packets.reserve(N_ENTRIES);
+  for (size_t i = 0; i < N_ENTRIES; ++i) {
+    shared_ptr<Data> data = make_shared<Data>(Name("/bench/ims/lookup").appendNumber(i / 100)
+                                                                      .appendNumber(i % 100));
+    Signature signature(SignatureInfo(tlv::DigestSha256));
+    signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+    data->setSignature(signature);
+    data->wireEncode();
+    data->getFullName();
+    packets.push_back(data);
+  }
+
+  std::vector<shared_ptr<Interest>> fullNameInterests;
+  std::vector<shared_ptr<Interest>> nameInterests;
+  std::mt19937 engine(20151202);
+  std::uniform_int_distribution<size_t> dist(0, N_ENTRIES - 1);
+  std::vector<size_t> order;
+  for (size_t i = 0; i < N_LOOKUPS; ++i) {
+    order.push_back(dist(engine));
+  }
+  for (size_t i = 0; i < 1000; ++i) {
+    fullNameInterests.push_back(make_shared<Interest>(packets[order[i]]->getFullName()));
+    nameInterests.push_back(make_shared<Interest>(packets[order[i]]->getName()));
+  }
+
+  util::InMemoryStorageLru ims(N_ENTRIES);
+  time::nanoseconds insertTime = timedExecute([&] {
+    for (const shared_ptr<Data>& data : packets) {
+      ims.insert(*data);
+    }
+  });
+  BOOST_CHECK_EQUAL(ims.size(), N_ENTRIES);
+
+  size_t nFound = 0;
+  auto report = [&] (const std::string& what, const time::nanoseconds& duration, size_t n) {
+    std::cout << std::setw(28) << what << ": " << std::setw(6) << duration.count() / n
+              << " ns/op" << std::endl;
+  };
+  report("insert", insertTime, N_ENTRIES);
+
+  report("find(Name), full name", timedExecute([&] {
+    for (size_t i = 0; i < N_LOOKUPS; ++i) {
+      nFound += ims.find(packets[order[i]]->getFullName()) != nullptr;
+    }
+  }), N_LOOKUPS);
+
+  report("find(Name), name", timedExecute([&] {
+    for (size_t i = 0; i < N_LOOKUPS; ++i) {
+      nFound += ims.find(packets[order[i]]->getName()) != nullptr;
+    }
+  }), N_LOOKUPS);
+
+  report("find(Interest), full name", timedExecute([&] {
+    for (size_t i = 0; i < N_LOOKUPS; ++i) {
+      nFound += ims.find(*fullNameInterests[i % fullNameInterests.size()]) != nullptr;
+    }
+  }), N_LOOKUPS);
+
+  report("find(Interest), name", timedExecute([&] {
+    for (size_t i = 0; i < N_LOOKUPS; ++i) {
+      nFound += ims.find(*nameInterests[i % nameInterests.size()]) != nullptr;
+    }
+  }), N_LOOKUPS);
+
+  BOOST_CHECK_EQUAL(nFound, 4 * N_LOOKUPS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "detail/interest-filter-table.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchInterestFilterTable)
+
+// Interest dispatch rate as a function of the number of registered filters
+BOOST_AUTO_TEST_CASE(DispatchInterests)
+{
+  const size_t N_INTERESTS = 100000;
+
+  std::vector<Name> interestNames;
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    interestNames.push_back(Name("/bench/producer").appendNumber(i % 1000)
+                                                   .appendVersion(i).appendSegment(0));
+  }
+
+  InterestFilterTable table;
+  size_t nFilters = 0;
+  for (size_t targetSize : {1, 10, 100, 1000, 10000}) {
+    for (; nFilters < targetSize; ++nFilters) {
+      table.push_back(make_shared<InterestFilterRecord>(
+                        InterestFilter(Name("/bench/producer").appendNumber(nFilters)),
+                        bind([]{})));
+    }
+
+    size_t nMatches = 0;
+    time::nanoseconds d = timedExecute([&] {
+      for (const Name& name : interestNames) {
+        nMatches += table.findAllMatches(name).size();
+      }
+    });
+
+    std::cout << std::setw(5) << nFilters << " filters: "
+              << std::setw(10) << static_cast<uint64_t>(N_INTERESTS * 1e9 / d.count())
+              << " Interests/s (" << nMatches << " matches)" << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "security/key-chain.hpp"
+#include "security/validator.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <boost/filesystem.hpp>
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchKeyChain)
+
+// Throughput of signing by identity with KeyChain::sign(Data&, SigningInfo), which looks the
+// signing certificate up in the PIB for each packet ("per packet"), and with a SigningContext
+// prepared once and reused for every packet ("prepared")
+BOOST_AUTO_TEST_CASE(Sign)
+{
+  const size_t N_SIGNATURES = 1000;
+  const boost::filesystem::path KEYCHAIN_PATH = boost::filesystem::temp_directory_path() /
+                                                boost::filesystem::unique_path();
+  boost::filesystem::create_directories(KEYCHAIN_PATH);
+
+  KeyChain keyChain("pib-sqlite3:" + KEYCHAIN_PATH.string(),
+                    "tpm-file:" + KEYCHAIN_PATH.string());
+  const Name rsaIdentity("/bench/key-chain/rsa");
+  const Name ecdsaIdentity("/bench/key-chain/ecdsa");
+  keyChain.createIdentity(rsaIdentity, RsaKeyParams(2048));
+  keyChain.createIdentity(ecdsaIdentity, EcdsaKeyParams(256));
+
+  const std::vector<uint8_t> content(1000, 0xbe);
+  Data data("/bench/key-chain/data");
+  data.setContent(content.data(), content.size());
+
+  for (const Name& identity : {rsaIdentity, ecdsaIdentity}) {
+    security::SigningInfo params(security::SigningInfo::SIGNER_TYPE_ID, identity);
+
+    time::nanoseconds perPacket = timedExecute([&] {
+      for (size_t i = 0; i < N_SIGNATURES; ++i) {
+        keyChain.sign(data, params);
+      }
+    });
+
+    time::nanoseconds prepared = timedExecute([&] {
+      security::SigningContext context = keyChain.prepareSigningContext(params);
+      for (size_t i = 0; i < N_SIGNATURES; ++i) {
+        keyChain.sign(data, context);
+      }
+    });
+
+    std::cout << std::setw(10) << (identity == rsaIdentity ? "RSA-2048" : "ECDSA-P256")
+              << ": per packet " << std::setw(8) << std::fixed << std::setprecision(0)
+              << N_SIGNATURES * 1e9 / perPacket.count() << " signatures/s, prepared "
+              << std::setw(8) << N_SIGNATURES * 1e9 / prepared.count() << " signatures/s"
+              << std::endl;
+  }
+
+  boost::filesystem::remove_all(KEYCHAIN_PATH);
+}
+
+// Throughput of signing and verifying 8192-octet segments one by one with
+// KeyChain::sign(Data&, SigningInfo), and in batches of 1, 64 and 1024 segments with
+// KeyChain::signBatch
+BOOST_AUTO_TEST_CASE(SignBatch)
+{
+  const size_t N_SEGMENTS = 1024;
+  const boost::filesystem::path KEYCHAIN_PATH = boost::filesystem::temp_directory_path() /
+                                                boost::filesystem::unique_path();
+  boost::filesystem::create_directories(KEYCHAIN_PATH);
+
+  KeyChain keyChain("pib-sqlite3:" + KEYCHAIN_PATH.string(),
+                    "tpm-file:" + KEYCHAIN_PATH.string());
+  const Name rsaIdentity("/bench/key-chain/rsa");
+  const Name ecdsaIdentity("/bench/key-chain/ecdsa");
+  keyChain.createIdentity(rsaIdentity, RsaKeyParams(2048));
+  keyChain.createIdentity(ecdsaIdentity, EcdsaKeyParams(256));
+
+  const std::vector<uint8_t> content(8192, 0xbe);
+  std::vector<Data> segments;
+  for (size_t i = 0; i < N_SEGMENTS; ++i) {
+    segments.push_back(Data(Name("/bench/key-chain/object").appendSegment(i)));
+    segments.back().setContent(content.data(), content.size());
+  }
+
+  for (const Name& identity : {rsaIdentity, ecdsaIdentity}) {
+    security::SigningInfo params(security::SigningInfo::SIGNER_TYPE_ID, identity);
+    shared_ptr<PublicKey> publicKey =
+      keyChain.getPublicKeyFromTpm(keyChain.getDefaultKeyNameForIdentity(identity));
+
+    for (size_t batchSize : {size_t(0), size_t(1), size_t(64), N_SEGMENTS}) {
+      time::nanoseconds signing = timedExecute([&] {
+        if (batchSize == 0) {
+          for (Data& data : segments) {
+            keyChain.sign(data, params);
+          }
+          return;
+        }
+        for (size_t first = 0; first < N_SEGMENTS; first += batchSize) {
+          std::vector<Data> batch(segments.begin() + first,
+                                  segments.begin() + first + batchSize);
+          keyChain.signBatch(batch, params);
+          std::copy(batch.begin(), batch.end(), segments.begin() + first);
+        }
+      });
+
+      size_t nVerified = 0;
+      time::nanoseconds verification = timedExecute([&] {
+        for (const Data& data : segments) {
+          nVerified += Validator::verifySignature(data, *publicKey);
+        }
+      });
+      BOOST_CHECK_EQUAL(nVerified, N_SEGMENTS);
+
+      std::cout << std::setw(10) << (identity == rsaIdentity ? "RSA-2048" : "ECDSA-P256")
+                << std::setw(14) << (batchSize == 0 ? std::string("sign") :
+                                     "batch of " + std::to_string(batchSize))
+                << ": " << std::setw(8) << std::fixed << std::setprecision(0)
+                << N_SEGMENTS * 1e9 / signing.count() << " signed segments/s, "
+                << std::setw(8) << N_SEGMENTS * 1e9 / verification.count()
+                << " verified segments/s, " << std::setw(4)
+                << segments.front().getSignature().getValue().size() << " octets SignatureValue"
+                << std::endl;
+    }
+  }
+
+  boost::filesystem::remove_all(KEYCHAIN_PATH);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
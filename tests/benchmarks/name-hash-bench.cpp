@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "name.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchNameHash)
+
+static const size_t N_ITERATIONS = 100000;
+
+static void
+printResult(const std::string& what, size_t nComponents, const time::nanoseconds& duration)
+{
+  std::cout << std::setw(36) << what << " (" << std::setw(2) << nComponents << " components): "
+            << std::setw(6) << duration.count() / N_ITERATIONS << " ns" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(HashPrefixes)
+{
+  std::hash<Name> hasher;
+
+  for (size_t nComponents : {4, 8, 20}) {
+    Name name;
+    for (size_t i = 0; i < nComponents; ++i)
+      name.append("component-" + std::to_string(i));
+
+    size_t checksum = 0;
+
+    // the same Name hashed repeatedly, e.g. as a key of several tables
+    time::nanoseconds repeated = timedExecute([&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        checksum += hasher(name);
+      }
+    });
+    printResult("hash of the same Name", nComponents, repeated);
+
+    // longest prefix match: every prefix is built by appending one component at a time
+    time::nanoseconds appended = timedExecute([&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        Name prefix;
+        checksum += hasher(prefix);
+        for (const name::Component& component : name) {
+          prefix.append(component);
+          checksum += hasher(prefix);
+        }
+      }
+    });
+    printResult("hash of all prefixes, append", nComponents, appended);
+
+    // every prefix is obtained via getPrefix
+    time::nanoseconds copied = timedExecute([&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        for (size_t j = 0; j <= name.size(); ++j) {
+          checksum += hasher(name.getPrefix(j));
+        }
+      }
+    });
+    printResult("hash of all prefixes, getPrefix", nComponents, copied);
+
+    // all prefix hashes computed at once
+    time::nanoseconds incremental = timedExecute([&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        Name copy(name);
+        std::vector<size_t> hashes = copy.getPrefixHashes();
+        checksum += hashes.back();
+      }
+    });
+    printResult("Name::getPrefixHashes", nComponents, incremental);
+
+    BOOST_CHECK_NE(checksum, 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
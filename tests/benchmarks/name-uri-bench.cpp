@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "name.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+#include "allocation-counter.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchNameUri)
+
+static const size_t N_ITERATIONS = 100000;
+
+template<typename F>
+static void
+measure(const std::string& what, const F& f)
+{
+  uint64_t nAllocations = 0;
+  time::nanoseconds duration = timedExecute([&] {
+    nAllocations = countAllocations(f);
+  });
+
+  std::cout << std::setw(28) << what << ": "
+            << std::setw(6) << duration.count() / N_ITERATIONS << " ns/op, "
+            << std::setw(5) << static_cast<double>(nAllocations) / N_ITERATIONS << " allocs/op"
+            << std::endl;
+}
+
+// Name::toUri and Name(const char*) of names ending with each kind of component
+BOOST_AUTO_TEST_CASE(ToUriAndParse)
+{
+  Name prefix("/example/bench/name-uri");
+  std::vector<std::pair<std::string, Name>> names = {
+    {"generic", Name(prefix).append(name::Component("file name with spaces.txt"))},
+    {"segment", Name(prefix).appendSegment(123456)},
+    {"version", Name(prefix).appendVersion(1449010000000)},
+    {"digest", Name(prefix).appendImplicitSha256Digest(make_shared<Buffer>(32))},
+  };
+
+  for (const auto& entry : names) {
+    const Name& name = entry.second;
+    std::string uri = name.toUri();
+    size_t totalSize = 0;
+
+    measure(entry.first + " toUri", [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        totalSize += name.toUri().size();
+      }
+    });
+
+    measure(entry.first + " parse", [&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        totalSize += Name(uri.c_str()).size();
+      }
+    });
+
+    BOOST_CHECK_EQUAL(Name(uri), name);
+    BOOST_CHECK_EQUAL(totalSize, N_ITERATIONS * (uri.size() + name.size()));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "name-view.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+#include "allocation-counter.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchNameView)
+
+static const size_t N_ITERATIONS = 100000;
+
+template<typename F>
+static void
+measure(const std::string& what, const F& f)
+{
+  uint64_t nAllocations = 0;
+  time::nanoseconds duration = timedExecute([&] {
+    nAllocations = countAllocations(f);
+  });
+
+  std::cout << std::setw(36) << what << ": "
+            << std::setw(6) << duration.count() / N_ITERATIONS << " ns/op, "
+            << std::setw(5) << static_cast<double>(nAllocations) / N_ITERATIONS << " allocs/op"
+            << std::endl;
+}
+
+// comparisons on the sub-names of a 20-component name, as done by the in-memory storage
+// and by the Interest filters
+BOOST_AUTO_TEST_CASE(SubNameCompare)
+{
+  Name name;
+  for (int i = 0; i < 20; ++i)
+    name.append(name::Component("component-" + std::to_string(i)));
+  Name prefix = name.getPrefix(10);
+  Name other = name.getPrefix(-1).append("other");
+
+  size_t nMatches = 0;
+
+  measure("Name::getPrefix + isPrefixOf", [&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      nMatches += prefix.isPrefixOf(name.getPrefix(15));
+    }
+  });
+  measure("NameView::getPrefix + isPrefixOf", [&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      nMatches += prefix.isPrefixOf(NameView(name).getPrefix(15));
+    }
+  });
+
+  measure("Name::getSubName + compare", [&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      nMatches += name.getSubName(5, 10).compare(other.getSubName(5, 10)) == 0;
+    }
+  });
+  measure("NameView::getSubName + compare", [&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      nMatches += NameView(name).getSubName(5, 10).compare(NameView(other).getSubName(5, 10)) == 0;
+    }
+  });
+
+  measure("hash of Name::getPrefix", [&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      nMatches += name.getPrefix(15).getHash() != 0;
+    }
+  });
+  measure("hash of NameView::getPrefix", [&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      nMatches += NameView(name).getPrefix(15).getHash() != 0;
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nMatches, 6 * N_ITERATIONS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
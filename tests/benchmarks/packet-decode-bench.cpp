@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "bead.hpp"
+#include "interest.hpp"
+#include "data.hpp"
+#include "security/digest-sha256.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchPacketDecode)
+
+static const size_t N_ITERATIONS = 1000000;
+
+static Name
+makeBenchName()
+{
+  return Name("/bench/decode/throughput/of/a/typical/name").appendSegment(42);
+}
+
+static void
+printResult(const std::string& what, const time::nanoseconds& duration, size_t wireSize)
+{
+  double nsPerPacket = static_cast<double>(duration.count()) / N_ITERATIONS;
+  std::cout << std::setw(32) << what << ": "
+            << std::setw(8) << static_cast<uint64_t>(nsPerPacket) << " ns/packet, "
+            << std::setw(8) << static_cast<uint64_t>(1e9 / nsPerPacket) << " packets/s, "
+            << std::setw(6) << static_cast<uint64_t>(wireSize * 1e3 / nsPerPacket) << " MB/s"
+            << std::endl;
+}
+
+// Decoding throughput of Bead (eager and lazy), Interest and Data
+BOOST_AUTO_TEST_CASE(Decode)
+{
+  Bead bead(makeBenchName());
+  bead.setToken("deletion-token-0123456789");
+  bead.setHops(3);
+  bead.setMustBeFresh(true);
+  Block beadWire = bead.wireEncode();
+
+  Interest interest(makeBenchName());
+  interest.setMustBeFresh(true);
+  interest.setNonce(1);
+  Block interestWire = interest.wireEncode();
+
+  Data data(makeBenchName());
+  static const uint8_t CONTENT[1024] = {};
+  data.setContent(CONTENT, sizeof(CONTENT));
+  Signature signature(SignatureInfo(tlv::DigestSha256));
+  signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+  data.setSignature(signature);
+  Block dataWire = data.wireEncode();
+
+  // every iteration decodes from a fresh copy of the wire, because Block::parse is cached
+  uint64_t checksum = 0;
+
+  time::nanoseconds beadEager = timedExecute([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      Bead decoded(Block(beadWire.getBuffer(), beadWire.begin(), beadWire.end()));
+      checksum += decoded.getHops() + decoded.getTokenView().value_size();
+    }
+  });
+  printResult("Bead (eager)", beadEager, beadWire.size());
+
+  time::nanoseconds beadLazy = timedExecute([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      Bead decoded(Block(beadWire.getBuffer(), beadWire.begin(), beadWire.end()),
+                   Bead::DECODE_LAZY);
+      checksum += decoded.getHops() + decoded.getTokenView().value_size();
+    }
+  });
+  printResult("Bead (lazy, hops and token)", beadLazy, beadWire.size());
+
+  time::nanoseconds beadLazyName = timedExecute([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      Bead decoded(Block(beadWire.getBuffer(), beadWire.begin(), beadWire.end()),
+                   Bead::DECODE_LAZY);
+      checksum += decoded.getHops() + decoded.getName().size();
+    }
+  });
+  printResult("Bead (lazy, hops and name)", beadLazyName, beadWire.size());
+
+  time::nanoseconds interestDecode = timedExecute([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      Interest decoded(Block(interestWire.getBuffer(), interestWire.begin(), interestWire.end()));
+      checksum += decoded.getName().size();
+    }
+  });
+  printResult("Interest", interestDecode, interestWire.size());
+
+  time::nanoseconds dataDecode = timedExecute([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      Data decoded(Block(dataWire.getBuffer(), dataWire.begin(), dataWire.end()));
+      checksum += decoded.getName().size();
+    }
+  });
+  printResult("Data", dataDecode, dataWire.size());
+
+  BOOST_CHECK_GT(checksum, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
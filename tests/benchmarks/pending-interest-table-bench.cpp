@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "detail/pending-interest-table.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+#include "make-interest-data.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchPendingInterestTable)
+
+// Data dispatch cost should not depend on the number of pending Interests
+BOOST_AUTO_TEST_CASE(SatisfyData)
+{
+  const size_t N_DATA = 10000;
+
+  boost::asio::io_service io;
+  util::Scheduler scheduler(io);
+
+  std::vector<shared_ptr<Data>> data;
+  for (size_t i = 0; i < N_DATA; ++i) {
+    data.push_back(util::makeData(Name("/bench/pit/data").appendNumber(i).appendSegment(0)));
+  }
+
+  PendingInterestTable table;
+  auto insertInterest = [&] (shared_ptr<Interest> interest) {
+    table.insert(make_shared<PendingInterest>(interest, bind([]{}), bind([]{}), ref(scheduler)));
+  };
+
+  // every test Data satisfies one pending Interest, and is a candidate for another one
+  // that it does not satisfy, so that each lookup goes through the whole dispatch
+  for (size_t i = 0; i < N_DATA; ++i) {
+    Name prefix = Name("/bench/pit/data").appendNumber(i);
+    insertInterest(make_shared<Interest>(prefix));
+
+    auto longer = make_shared<Interest>(prefix);
+    longer->setMinSuffixComponents(3);
+    insertInterest(longer);
+  }
+
+  size_t tableSize = table.size();
+  for (size_t targetSize : {N_DATA * 2, N_DATA * 10, N_DATA * 100}) {
+    for (; tableSize < targetSize; ++tableSize) {
+      // pending Interests that are not related to the test Data
+      Name name("/bench/pit/pending");
+      name.appendNumber(tableSize);
+      insertInterest(make_shared<Interest>(name));
+    }
+
+    size_t nMatches = 0;
+    time::nanoseconds d = timedExecute([&] {
+      for (const auto& dataPtr : data) {
+        nMatches += table.findAllMatches(*dataPtr).size();
+      }
+    });
+    BOOST_CHECK_EQUAL(nMatches, N_DATA);
+
+    std::cout << "PIT size " << std::setw(7) << table.size() << ": "
+              << std::setw(8) << d.count() / N_DATA << " ns/Data" << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
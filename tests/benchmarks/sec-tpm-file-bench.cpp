@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "security/sec-tpm-file.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <boost/filesystem.hpp>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchSecTpmFile)
+
+// Throughput of SecTpmFile::signInTpm over a 1000-octet message, with the private key
+// loaded once by the same SecTpmFile ("warm"), and with a new SecTpmFile for every signature,
+// which reads and parses the key files every time ("cold")
+BOOST_AUTO_TEST_CASE(Sign)
+{
+  const size_t N_SIGNATURES = 1000;
+  const boost::filesystem::path TPM_PATH = boost::filesystem::temp_directory_path() /
+                                           boost::filesystem::unique_path();
+
+  const std::vector<uint8_t> message(1000, 0xbe);
+  const Name rsaKeyName("/bench/tpm-file/rsa");
+  const Name ecdsaKeyName("/bench/tpm-file/ecdsa");
+  {
+    SecTpmFile tpm(TPM_PATH.string());
+    tpm.generateKeyPairInTpm(rsaKeyName, RsaKeyParams(2048));
+    tpm.generateKeyPairInTpm(ecdsaKeyName, EcdsaKeyParams(256));
+  }
+  // until the key files are older than the granularity of file timestamps, a loaded key is
+  // checked against the content of its file on every signature
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+
+  for (const Name& keyName : {rsaKeyName, ecdsaKeyName}) {
+    SecTpmFile warmTpm(TPM_PATH.string());
+    time::nanoseconds warm = timedExecute([&] {
+      for (size_t i = 0; i < N_SIGNATURES; ++i) {
+        warmTpm.signInTpm(message.data(), message.size(), keyName, DIGEST_ALGORITHM_SHA256);
+      }
+    });
+
+    time::nanoseconds cold = timedExecute([&] {
+      for (size_t i = 0; i < N_SIGNATURES; ++i) {
+        SecTpmFile coldTpm(TPM_PATH.string());
+        coldTpm.signInTpm(message.data(), message.size(), keyName, DIGEST_ALGORITHM_SHA256);
+      }
+    });
+
+    std::cout << std::setw(10) << (keyName == rsaKeyName ? "RSA-2048" : "ECDSA-P256")
+              << ": warm " << std::setw(8) << std::fixed << std::setprecision(0)
+              << N_SIGNATURES * 1e9 / warm.count() << " signatures/s, cold "
+              << std::setw(8) << N_SIGNATURES * 1e9 / cold.count() << " signatures/s"
+              << std::endl;
+  }
+
+  boost::filesystem::remove_all(TPM_PATH);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "encoding/block.hpp"
+#include "data.hpp"
+#include "security/digest-sha256.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchTlvFraming)
+
+static void
+printResult(const std::string& what, const time::nanoseconds& duration,
+            size_t nBytes, size_t nElements)
+{
+  std::cout << std::setw(40) << what << ": "
+            << std::setw(6) << static_cast<uint64_t>(nBytes * 1e3 / duration.count()) << " MB/s, "
+            << std::setw(6) << duration.count() / nElements << " ns/packet" << std::endl;
+}
+
+// Framing a 64 MB stream of concatenated Data packets into top-level elements
+BOOST_AUTO_TEST_CASE(Split64MB)
+{
+  const size_t STREAM_SIZE = 64 * 1024 * 1024;
+
+  auto stream = make_shared<Buffer>();
+  stream->reserve(STREAM_SIZE + MAX_NDN_PACKET_SIZE);
+  size_t nPackets = 0;
+  for (size_t i = 0; stream->size() < STREAM_SIZE; ++i) {
+    Data data(Name("/bench/framing").appendSegment(i));
+    // content sizes vary to exercise 1-octet and 3-octet TLV-LENGTH
+    std::vector<uint8_t> content(i % 1200);
+    data.setContent(content.data(), content.size());
+    Signature signature(SignatureInfo(tlv::DigestSha256));
+    signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+    data.setSignature(signature);
+    const Block& wire = data.wireEncode();
+    stream->insert(stream->end(), wire.begin(), wire.end());
+    ++nPackets;
+  }
+
+  size_t nElements = 0;
+  size_t nSubElements = 0;
+
+  // one Block::fromBuffer call per packet, each copying the packet into its own buffer
+  time::nanoseconds copying = timedExecute([&] {
+    nElements = 0;
+    for (size_t offset = 0; offset < stream->size(); ++nElements) {
+      bool isOk = false;
+      Block element;
+      std::tie(isOk, element) = Block::fromBuffer(stream->buf() + offset, stream->size() - offset);
+      if (!isOk)
+        break;
+      offset += element.size();
+    }
+  });
+  BOOST_CHECK_EQUAL(nElements, nPackets);
+  printResult("Block::fromBuffer(const uint8_t*)", copying, stream->size(), nElements);
+
+  // one Block::fromBuffer call per packet, sharing the stream buffer
+  time::nanoseconds sharing = timedExecute([&] {
+    nElements = 0;
+    for (size_t offset = 0; offset < stream->size(); ++nElements) {
+      bool isOk = false;
+      Block element;
+      std::tie(isOk, element) = Block::fromBuffer(stream, offset);
+      if (!isOk)
+        break;
+      offset += element.size();
+    }
+  });
+  BOOST_CHECK_EQUAL(nElements, nPackets);
+  printResult("Block::fromBuffer(ConstBufferPtr)", sharing, stream->size(), nElements);
+
+  // batch splitting of the stream
+  time::nanoseconds splitting = timedExecute([&] {
+    nElements = 0;
+    const uint8_t* end = tlv::splitElements(stream->buf(), stream->buf() + stream->size(),
+      [&] (uint32_t, const uint8_t*, const uint8_t*, const uint8_t*) { ++nElements; });
+    BOOST_REQUIRE(end == stream->buf() + stream->size());
+  });
+  BOOST_CHECK_EQUAL(nElements, nPackets);
+  printResult("tlv::splitElements", splitting, stream->size(), nElements);
+
+  // framing followed by Block::parse of every packet
+  time::nanoseconds parsing = timedExecute([&] {
+    nElements = 0;
+    nSubElements = 0;
+    for (size_t offset = 0; offset < stream->size(); ++nElements) {
+      Block element = std::get<1>(Block::fromBuffer(stream, offset));
+      element.parse();
+      nSubElements += element.elements_size();
+      offset += element.size();
+    }
+  });
+  BOOST_CHECK_GE(nSubElements, nPackets * 5);
+  printResult("Block::fromBuffer + Block::parse", parsing, stream->size(), nElements);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "util/token-table.hpp"
+#include "encoding/block-helpers.hpp"
+
+#include "boost-test.hpp"
+#include "timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(BenchTokenTable)
+
+// Correlating Beads with Data by token: TokenTable vs std::map keyed on readString(token)
+BOOST_AUTO_TEST_CASE(CorrelateBeads)
+{
+  const size_t N_LOOKUPS = 1000000;
+
+  boost::asio::io_service io;
+  util::Scheduler scheduler(io);
+
+  for (size_t nTokens : {100, 10000, 1000000}) {
+    std::vector<shared_ptr<Bead>> beads;
+    for (size_t i = 0; i < nTokens; ++i) {
+      auto bead = make_shared<Bead>(Name("/bench/bead").appendNumber(i));
+      bead->setToken("deletion-token-" + std::to_string(i * 7919));
+      bead->wireEncode();
+      beads.push_back(bead);
+    }
+
+    util::TokenTable<size_t> table(scheduler, time::seconds(60));
+    std::map<std::string, size_t> map;
+    time::nanoseconds tableInsert = timedExecute([&] {
+      for (size_t i = 0; i < nTokens; ++i) {
+        table.insert(*beads[i], i);
+      }
+    });
+    time::nanoseconds mapInsert = timedExecute([&] {
+      for (size_t i = 0; i < nTokens; ++i) {
+        map[readString(beads[i]->getTokenView())] = i;
+      }
+    });
+
+    size_t tableSum = 0;
+    time::nanoseconds tableFind = timedExecute([&] {
+      for (size_t i = 0; i < N_LOOKUPS; ++i) {
+        tableSum += *table.find(*beads[i % nTokens]);
+      }
+    });
+    size_t mapSum = 0;
+    time::nanoseconds mapFind = timedExecute([&] {
+      for (size_t i = 0; i < N_LOOKUPS; ++i) {
+        mapSum += map.find(readString(beads[i % nTokens]->getTokenView()))->second;
+      }
+    });
+    BOOST_CHECK_EQUAL(tableSum, mapSum);
+
+    std::cout << std::setw(7) << nTokens << " tokens: "
+              << "TokenTable insert " << tableInsert.count() / nTokens << " ns, "
+              << "find " << tableFind.count() / N_LOOKUPS << " ns; "
+              << "std::map insert " << mapInsert.count() / nTokens << " ns, "
+              << "find " << mapFind.count() / N_LOOKUPS << " ns" << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
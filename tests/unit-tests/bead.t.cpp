@@ -0,0 +1,347 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "bead.hpp"
+#include "link.hpp"
+#include "security/digest-sha256.hpp"
+
+#include "boost-test.hpp"
+
+#include <random>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestBead)
+
+BOOST_AUTO_TEST_CASE(SetHopsInPlace)
+{
+  Bead bead("/A/B");
+  bead.setToken("token");
+  bead.setNonce(1);
+
+  const Block& wire = bead.wireEncode();
+  const uint8_t* wireBuffer = wire.wire();
+  size_t wireSize = wire.size();
+
+  // hop count is patched in the existing wire, which is not re-encoded
+  for (uint64_t hops : std::vector<uint64_t>{1, 255, 256, 65536, 4294967296}) {
+    bead.setHops(hops);
+    BOOST_CHECK(bead.hasWire());
+    BOOST_CHECK_EQUAL(bead.getHops(), hops);
+    BOOST_CHECK(bead.wireEncode().wire() == wireBuffer);
+    BOOST_CHECK_EQUAL(bead.wireEncode().size(), wireSize);
+
+    Bead decoded(bead.wireEncode());
+    BOOST_CHECK_EQUAL(decoded.getHops(), hops);
+    BOOST_CHECK_EQUAL(decoded.getName(), "/A/B");
+    BOOST_CHECK_EQUAL(decoded.getToken(), "token");
+  }
+
+  // a change to another field still resets the wire
+  bead.setName("/C");
+  BOOST_CHECK(!bead.hasWire());
+  BOOST_CHECK_EQUAL(Bead(bead.wireEncode()).getHops(), 4294967296);
+}
+
+BOOST_AUTO_TEST_CASE(SetHopsOnCopy)
+{
+  Bead bead("/A/B");
+  bead.setHops(1);
+  Block wire = bead.wireEncode();
+
+  // the wire is shared with the Block above and with the copy, so it is not patched in place
+  Bead copy(bead);
+  copy.setHops(2);
+  BOOST_CHECK_EQUAL(copy.getHops(), 2);
+  BOOST_CHECK_EQUAL(bead.getHops(), 1);
+  BOOST_CHECK_EQUAL(Bead(bead.wireEncode()).getHops(), 1);
+  BOOST_CHECK_EQUAL(Bead(wire).getHops(), 1);
+  BOOST_CHECK_EQUAL(Bead(copy.wireEncode()).getHops(), 2);
+
+  bead.setHops(3);
+  BOOST_CHECK_EQUAL(bead.getHops(), 3);
+  BOOST_CHECK_EQUAL(copy.getHops(), 2);
+  BOOST_CHECK_EQUAL(Bead(wire).getHops(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(SetHopsVariableWidth)
+{
+  // Bead from another encoder with a 1-octet BeadHops cannot be patched in place
+  Bead bead("/A");
+  bead.setToken("token");
+  Block wire = bead.wireEncode();
+  wire.parse();
+
+  Block modified(tlv::Bead);
+  for (const Block& element : wire.elements()) {
+    if (element.type() == tlv::BeadHops)
+      modified.push_back(makeNonNegativeIntegerBlock(tlv::BeadHops, 3));
+    else
+      modified.push_back(element);
+  }
+  modified.encode();
+
+  Bead decoded(modified);
+  BOOST_CHECK_EQUAL(decoded.getHops(), 3);
+  decoded.setHops(4);
+  BOOST_CHECK(!decoded.hasWire());
+  BOOST_CHECK_EQUAL(Bead(decoded.wireEncode()).getHops(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(TokenAndHopsDefaults)
+{
+  const Bead bead("/A");
+  BOOST_CHECK_EQUAL(bead.getToken(), "");
+  BOOST_CHECK_EQUAL(bead.getTokenView().type(), tlv::Token);
+  BOOST_CHECK_EQUAL(bead.getTokenView().value_size(), 0);
+  BOOST_CHECK_EQUAL(bead.getHops(), 0);
+
+  // Bead without token can be encoded and decoded
+  Bead decoded(bead.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.getToken(), "");
+  BOOST_CHECK_EQUAL(decoded.getHops(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GetTokenView)
+{
+  Bead bead("/A");
+  bead.setToken("deletion-token");
+  bead.setHops(2);
+
+  Bead decoded(bead.wireEncode());
+  const Block& token = decoded.getTokenView();
+  BOOST_CHECK_EQUAL(std::string(reinterpret_cast<const char*>(token.value()), token.value_size()),
+                    "deletion-token");
+  // the view points into the decoded wire, no copy is made
+  BOOST_CHECK(token.value() >= decoded.wireEncode().wire());
+  BOOST_CHECK(token.value() + token.value_size() <=
+              decoded.wireEncode().wire() + decoded.wireEncode().size());
+
+  // accessors do not modify the Bead
+  BOOST_CHECK(decoded.hasWire());
+  BOOST_CHECK_EQUAL(decoded.getToken(), "deletion-token");
+  BOOST_CHECK_EQUAL(decoded.getHops(), 2);
+  BOOST_CHECK(decoded.hasWire());
+}
+
+BOOST_AUTO_TEST_CASE(LazyDecode)
+{
+  Bead bead("/A/B");
+  bead.setToken("token");
+  bead.setHops(5);
+  bead.setMustBeFresh(true);
+  bead.setNonce(1);
+  bead.setBeadLifetime(time::seconds(1));
+  Block wire = bead.wireEncode();
+
+  Bead decoded(wire, Bead::DECODE_LAZY);
+  BOOST_CHECK_EQUAL(decoded.getHops(), 5);
+  BOOST_CHECK_EQUAL(decoded.getToken(), "token");
+  BOOST_CHECK_EQUAL(decoded.getNonce(), 1);
+  BOOST_CHECK_EQUAL(decoded.getBeadLifetime(), time::seconds(1));
+  BOOST_CHECK_EQUAL(decoded.getName(), "/A/B");
+  BOOST_CHECK_EQUAL(decoded.getMustBeFresh(), true);
+  BOOST_CHECK(decoded == bead);
+
+  // re-encoding after a change reuses the undecoded Name and Selectors
+  Bead reencoded(wire, Bead::DECODE_LAZY);
+  reencoded.setToken("other");
+  Bead expected(bead);
+  expected.setToken("other");
+  BOOST_CHECK(reencoded.wireEncode() == expected.wireEncode());
+
+  // a selector can be changed before Selectors is decoded
+  Bead modified(wire, Bead::DECODE_LAZY);
+  modified.setChildSelector(1);
+  BOOST_CHECK_EQUAL(modified.getMustBeFresh(), true);
+  BOOST_CHECK_EQUAL(modified.getChildSelector(), 1);
+  BOOST_CHECK_EQUAL(Bead(modified.wireEncode()).getChildSelector(), 1);
+
+  // a malformed Name is reported on access
+  Block malformed(tlv::Bead);
+  wire.parse();
+  for (const Block& element : wire.elements()) {
+    if (element.type() == tlv::Name)
+      malformed.push_back(makeNonNegativeIntegerBlock(tlv::Name, 1));
+    else
+      malformed.push_back(element);
+  }
+  malformed.encode();
+  BOOST_CHECK_THROW(Bead{malformed}, tlv::Error);
+  Bead lazy(malformed, Bead::DECODE_LAZY);
+  BOOST_CHECK_EQUAL(lazy.getHops(), 5);
+  BOOST_CHECK_THROW(lazy.getName(), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeMissingElement)
+{
+  Block wire = Bead("/A").wireEncode();
+  wire.parse();
+
+  Block withoutToken(tlv::Bead);
+  for (const Block& element : wire.elements()) {
+    if (element.type() != tlv::Token)
+      withoutToken.push_back(element);
+  }
+  withoutToken.encode();
+  BOOST_CHECK_THROW(Bead(withoutToken, Bead::DECODE_LAZY), Bead::Error);
+}
+
+class RandomBeadFixture
+{
+protected:
+  RandomBeadFixture()
+    : m_random(20151109) // fixed seed, so that failures are reproducible
+  {
+  }
+
+  size_t
+  randomNumber(size_t max)
+  {
+    return std::uniform_int_distribution<size_t>(0, max)(m_random);
+  }
+
+  std::string
+  randomString(size_t maxSize)
+  {
+    std::string s(randomNumber(maxSize), '\0');
+    for (char& c : s)
+      c = static_cast<char>(randomNumber(255));
+    return s;
+  }
+
+  Name
+  randomName()
+  {
+    Name name;
+    size_t nComponents = randomNumber(8);
+    for (size_t i = 0; i < nComponents; ++i)
+      name.append(name::Component(randomString(12)));
+    return name;
+  }
+
+  Block
+  randomLink()
+  {
+    Link link(randomName());
+    size_t nDelegations = 1 + randomNumber(3);
+    for (size_t i = 0; i < nDelegations; ++i)
+      link.addDelegation(static_cast<uint32_t>(randomNumber(100)), randomName());
+    Signature signature(SignatureInfo(tlv::DigestSha256));
+    signature.setValue(makeEmptyBlock(tlv::SignatureValue));
+    link.setSignature(signature);
+    return link.wireEncode();
+  }
+
+  Bead
+  randomBead()
+  {
+    Bead bead(randomName());
+    if (randomNumber(1))
+      bead.setToken(randomString(32));
+    if (randomNumber(1))
+      bead.setHops(randomNumber(1) ? randomNumber(255) : std::numeric_limits<uint64_t>::max());
+    if (randomNumber(1))
+      bead.setMustBeFresh(true);
+    if (randomNumber(1))
+      bead.setChildSelector(static_cast<int>(randomNumber(1)));
+    if (randomNumber(1))
+      bead.setMinSuffixComponents(static_cast<int>(randomNumber(4)));
+    if (randomNumber(1))
+      bead.setExclude(Exclude().excludeOne(name::Component(randomString(8))));
+    if (randomNumber(1))
+      bead.setBeadLifetime(time::milliseconds(randomNumber(100000)));
+    if (randomNumber(1)) {
+      bead.setLink(randomLink());
+      if (randomNumber(1))
+        bead.setSelectedDelegation(size_t(0));
+    }
+    bead.setNonce(static_cast<uint32_t>(randomNumber(0xFFFFFFFF)));
+    return bead;
+  }
+
+protected:
+  std::mt19937 m_random;
+};
+
+BOOST_FIXTURE_TEST_CASE(RandomizedRoundTrip, RandomBeadFixture)
+{
+  for (int i = 0; i < 1000; ++i) {
+    Bead bead = randomBead();
+    Block wire = bead.wireEncode();
+
+    for (Bead::DecodeMode mode : {Bead::DECODE_EAGER, Bead::DECODE_LAZY}) {
+      Bead decoded(Block(wire.getBuffer(), wire.begin(), wire.end()), mode);
+      BOOST_REQUIRE_EQUAL(decoded.getName(), bead.getName());
+      BOOST_REQUIRE(decoded.getSelectors() == bead.getSelectors());
+      BOOST_REQUIRE_EQUAL(decoded.getToken(), bead.getToken());
+      BOOST_REQUIRE_EQUAL(decoded.getHops(), bead.getHops());
+      BOOST_REQUIRE_EQUAL(decoded.getNonce(), bead.getNonce());
+      BOOST_REQUIRE_EQUAL(decoded.hasLink(), bead.hasLink());
+      BOOST_REQUIRE_EQUAL(decoded.hasSelectedDelegation(), bead.hasSelectedDelegation());
+
+      // changing the hop count of a copy does not affect the original or the shared wire
+      Bead copy(decoded);
+      copy.setHops(bead.getHops() + 1);
+      BOOST_REQUIRE_EQUAL(copy.getHops(), bead.getHops() + 1);
+      BOOST_REQUIRE_EQUAL(decoded.getHops(), bead.getHops());
+      BOOST_REQUIRE_EQUAL(Bead(decoded.wireEncode()).getHops(), bead.getHops());
+      BOOST_REQUIRE_EQUAL(Bead(wire).getHops(), bead.getHops());
+
+      // re-encoding a modified copy produces the same wire as modifying the original
+      uint32_t nonce = decoded.getNonce() + 1;
+      decoded.setNonce(nonce);
+      decoded.setToken("modified");
+      Bead expected(bead);
+      expected.setNonce(nonce);
+      expected.setToken("modified");
+      BOOST_REQUIRE(decoded.wireEncode() == expected.wireEncode());
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(RandomizedCorruption, RandomBeadFixture)
+{
+  // decoding a corrupted Bead either succeeds or throws tlv::Error
+  for (int i = 0; i < 1000; ++i) {
+    Block wire = randomBead().wireEncode();
+    Buffer corrupted(wire.wire(), wire.size());
+    size_t nMutations = 1 + randomNumber(3);
+    for (size_t j = 0; j < nMutations; ++j)
+      corrupted[randomNumber(corrupted.size() - 1)] = static_cast<uint8_t>(randomNumber(255));
+
+    try {
+      Block block(corrupted.buf(), corrupted.size());
+      Bead decoded(block);
+      decoded.getToken();
+      decoded.getHops();
+      decoded.wireEncode();
+    }
+    catch (const tlv::Error&) {
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
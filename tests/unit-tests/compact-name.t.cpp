@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "compact-name.hpp"
+
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestCompactName)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  Name name("/local/ndn/prefix");
+  CompactName compact(name);
+
+  BOOST_CHECK_EQUAL(compact.size(), 3);
+  BOOST_CHECK(!compact.empty());
+  BOOST_CHECK_EQUAL(compact[0], name::Component("local"));
+  BOOST_CHECK_EQUAL(compact[-1], name::Component("prefix"));
+  BOOST_CHECK_EQUAL(compact.at(1), name::Component("ndn"));
+  BOOST_CHECK_THROW(compact.at(3), Name::Error);
+  BOOST_CHECK_THROW(compact.at(-4), CompactName::Error);
+  BOOST_CHECK_EQUAL(compact.toUri(), "/local/ndn/prefix");
+  BOOST_CHECK_EQUAL(compact.toName(), name);
+
+  // the wire encoding is shared with the Name
+  BOOST_CHECK(compact.wireEncode() == name.wireEncode());
+  BOOST_CHECK(compact.wireEncode().getBuffer() == name.wireEncode().getBuffer());
+
+  std::vector<name::Component> components(compact.begin(), compact.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(components.begin(), components.end(), name.begin(), name.end());
+
+  CompactName empty;
+  BOOST_CHECK(empty.empty());
+  BOOST_CHECK_EQUAL(empty.toUri(), "/");
+  BOOST_CHECK(empty.wireEncode() == Name().wireEncode());
+  BOOST_CHECK(empty.begin() == empty.end());
+}
+
+BOOST_AUTO_TEST_CASE(ManyComponents)
+{
+  // more components than the inline offset table holds
+  Name name;
+  CompactName compact;
+  for (size_t i = 0; i < CompactName::INLINE_CAPACITY * 3; ++i) {
+    name.appendSegment(i);
+    compact.append(name::Component::fromSegment(i));
+    BOOST_CHECK(compact.wireEncode() == name.wireEncode());
+  }
+
+  BOOST_CHECK_EQUAL(compact.size(), name.size());
+  for (size_t i = 0; i < name.size(); ++i) {
+    BOOST_CHECK_EQUAL(compact[i], name[i]);
+  }
+
+  CompactName decoded(name.wireEncode());
+  BOOST_CHECK_EQUAL(decoded, compact);
+  BOOST_CHECK_EQUAL(decoded.toName(), name);
+
+  CompactName copy = decoded;
+  BOOST_CHECK_EQUAL(copy[-1], name[-1]);
+}
+
+BOOST_AUTO_TEST_CASE(Decode)
+{
+  Name name("/A/B");
+  name.appendImplicitSha256Digest(make_shared<Buffer>(32));
+  CompactName compact(name.wireEncode());
+  BOOST_CHECK_EQUAL(compact.toName(), name);
+  BOOST_CHECK(compact[-1].isImplicitSha256Digest());
+
+  // a Block without wire
+  Block block(tlv::Name);
+  block.push_back(name::Component("X"));
+  BOOST_CHECK_EQUAL(CompactName(block).toUri(), "/X");
+
+  BOOST_CHECK_THROW(CompactName(makeEmptyBlock(tlv::Data)), tlv::Error);
+
+  static const uint8_t truncated[] = {0x07, 0x03, 0x08, 0x02, 0x41};
+  BOOST_CHECK_THROW(CompactName(Block(truncated, sizeof(truncated))), tlv::Error);
+
+  Name longName;
+  longName.append(name::Component(std::string(70000, 'a')));
+  BOOST_CHECK_THROW(CompactName{longName}, CompactName::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Compare)
+{
+  std::vector<Name> names = {"/", "/A", "/A/B", "/A/C", "/B", "/AA", "/%00"};
+  for (const Name& lhs : names) {
+    for (const Name& rhs : names) {
+      CompactName compactLhs(lhs), compactRhs(rhs);
+      BOOST_CHECK_EQUAL(compactLhs.compare(compactRhs) < 0, lhs.compare(rhs) < 0);
+      BOOST_CHECK_EQUAL(compactLhs.compare(compactRhs) == 0, lhs.compare(rhs) == 0);
+      BOOST_CHECK_EQUAL(compactLhs == compactRhs, lhs == rhs);
+      BOOST_CHECK_EQUAL(compactLhs < compactRhs, lhs < rhs);
+      BOOST_CHECK_EQUAL(compactLhs.isPrefixOf(compactRhs), lhs.isPrefixOf(rhs));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  Name name("/A/B/C");
+  BOOST_CHECK_EQUAL(CompactName(name).getHash(), name.getHash());
+  BOOST_CHECK_EQUAL(std::hash<CompactName>()(CompactName("/A/B/C")), std::hash<Name>()(name));
+  BOOST_CHECK_EQUAL(CompactName().getHash(), Name().getHash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
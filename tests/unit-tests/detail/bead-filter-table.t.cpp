@@ -0,0 +1,74 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "detail/bead-filter-table.hpp"
+
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(DetailBeadFilterTable)
+
+BOOST_AUTO_TEST_CASE(Dispatch)
+{
+  BeadFilterTable table;
+
+  std::vector<Name> invoked;
+  shared_ptr<const Bead> received;
+  auto makeRecord = [&] (const Name& prefix) {
+    return make_shared<BeadFilterRecord>(prefix,
+      [&] (const Name& filterPrefix, const shared_ptr<const Bead>& bead) {
+        invoked.push_back(filterPrefix);
+        received = bead;
+      });
+  };
+
+  table.push_back(makeRecord("/A/B"));
+  table.push_back(makeRecord("/C"));
+  table.push_back(makeRecord("/A"));
+  table.push_back(makeRecord("/A/B/C/D"));
+
+  auto bead = make_shared<Bead>("/A/B/C");
+  for (const auto& record : table.findAllMatches(bead->getName())) {
+    record->invokeBeadCallback(bead);
+  }
+
+  std::vector<Name> expected{"/A/B", "/A"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(invoked.begin(), invoked.end(),
+                                expected.begin(), expected.end());
+  // the same Bead instance is handed over to the callback
+  BOOST_CHECK_EQUAL(received, bead);
+
+  auto i = std::find_if(table.begin(), table.end(),
+                        [] (const shared_ptr<BeadFilterRecord>& record) {
+                          return record->getPrefix() == "/A";
+                        });
+  BOOST_REQUIRE(i != table.end());
+  table.erase(i);
+  BOOST_CHECK_EQUAL(table.findAllMatches("/A/B/C").size(), 1);
+  BOOST_CHECK(table.findAllMatches("/A").empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
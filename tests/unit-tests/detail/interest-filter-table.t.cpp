@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "detail/interest-filter-table.hpp"
+
+#include "boost-test.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+namespace ndn {
+namespace tests {
+
+class InterestFilterTableFixture
+{
+public:
+  shared_ptr<InterestFilterRecord>
+  add(const InterestFilter& filter)
+  {
+    auto record = make_shared<InterestFilterRecord>(filter, bind([]{}));
+    table.push_back(record);
+    return record;
+  }
+
+  std::vector<std::string>
+  findAllMatches(const Name& name)
+  {
+    std::vector<std::string> filters;
+    for (const auto& record : table.findAllMatches(name)) {
+      filters.push_back(boost::lexical_cast<std::string>(record->getFilter()));
+    }
+    return filters;
+  }
+
+public:
+  InterestFilterTable table;
+};
+
+BOOST_FIXTURE_TEST_SUITE(DetailInterestFilterTable, InterestFilterTableFixture)
+
+BOOST_AUTO_TEST_CASE(PrefixAndRegex)
+{
+  add(InterestFilter("/A/B"));
+  add(InterestFilter("/A", "<B><>"));
+  add(InterestFilter("/"));
+  add(InterestFilter("/A/C"));
+  add(InterestFilter("/A/B/C/D"));
+  add(InterestFilter("/A/B"));
+  BOOST_CHECK_EQUAL(table.size(), 6);
+
+  std::vector<std::string> matches = findAllMatches("/A/B/C");
+  std::vector<std::string> expected{"/A/B", "/A?regex=<B><>", "/", "/A/B"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(),
+                                expected.begin(), expected.end());
+
+  matches = findAllMatches("/A/B");
+  expected = {"/A/B", "/", "/A/B"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(),
+                                expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Remove)
+{
+  auto ab1 = add(InterestFilter("/A/B"));
+  auto regex = add(InterestFilter("/A", "<B><>"));
+  auto ab2 = add(InterestFilter("/A/B"));
+  BOOST_CHECK_EQUAL(table.findAllMatches("/A/B/C").size(), 3);
+
+  table.remove(ab1);
+  BOOST_CHECK_EQUAL(table.findAllMatches("/A/B/C").size(), 2);
+
+  auto i = std::find(table.begin(), table.end(), regex);
+  BOOST_REQUIRE(i != table.end());
+  table.erase(i);
+  BOOST_REQUIRE_EQUAL(table.findAllMatches("/A/B/C").size(), 1);
+  BOOST_CHECK_EQUAL(table.findAllMatches("/A/B/C").front(), ab2);
+
+  table.clear();
+  BOOST_CHECK(table.empty());
+  BOOST_CHECK(table.findAllMatches("/A/B/C").empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
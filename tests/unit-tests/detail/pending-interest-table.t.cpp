@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "detail/pending-interest-table.hpp"
+
+#include "boost-test.hpp"
+#include "../unit-test-time-fixture.hpp"
+#include "../make-interest-data.hpp"
+
+namespace ndn {
+namespace tests {
+
+class PendingInterestTableFixture : public UnitTestTimeFixture
+{
+public:
+  PendingInterestTableFixture()
+    : scheduler(io)
+  {
+  }
+
+  PendingInterestTable::iterator
+  insert(const Interest& interest)
+  {
+    return table.insert(make_shared<PendingInterest>(make_shared<Interest>(interest),
+                                                     bind([]{}), bind([]{}),
+                                                     ref(scheduler))).first;
+  }
+
+  std::vector<Name>
+  findAllMatches(const Data& data)
+  {
+    std::vector<Name> names;
+    for (auto entry : table.findAllMatches(data)) {
+      names.push_back((*entry)->getInterest().getName());
+    }
+    return names;
+  }
+
+public:
+  util::Scheduler scheduler;
+  PendingInterestTable table;
+};
+
+BOOST_FIXTURE_TEST_SUITE(DetailPendingInterestTable, PendingInterestTableFixture)
+
+BOOST_AUTO_TEST_CASE(PrefixMatch)
+{
+  insert(Interest("/"));
+  insert(Interest("/A/B"));
+  insert(Interest("/A/B/C/D"));
+  insert(Interest("/A"));
+  insert(Interest("/X"));
+  BOOST_CHECK_EQUAL(table.size(), 5);
+
+  std::vector<Name> matches = findAllMatches(*util::makeData("/A/B/C"));
+  std::vector<Name> expected{"/", "/A/B", "/A"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(),
+                                expected.begin(), expected.end());
+
+  BOOST_CHECK(findAllMatches(*util::makeData("/Y")) == std::vector<Name>{"/"});
+}
+
+BOOST_AUTO_TEST_CASE(Selectors)
+{
+  insert(Interest("/A").setMinSuffixComponents(3));
+  insert(Interest("/A").setMaxSuffixComponents(2));
+
+  Exclude exclude;
+  exclude.excludeOne(name::Component("B"));
+  insert(Interest("/A").setExclude(exclude));
+
+  BOOST_CHECK(findAllMatches(*util::makeData("/A/B")) == std::vector<Name>{"/A"});
+  BOOST_CHECK_EQUAL(findAllMatches(*util::makeData("/A/B/C")).size(), 1);
+  BOOST_CHECK_EQUAL(findAllMatches(*util::makeData("/A/C")).size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ImplicitDigest)
+{
+  shared_ptr<Data> data = util::makeData("/A/B");
+  insert(Interest(data->getFullName()));
+  uint8_t otherDigest[32] = {0};
+  insert(Interest(Name("/A/B").appendImplicitSha256Digest(otherDigest, sizeof(otherDigest))));
+
+  BOOST_CHECK(findAllMatches(*data) == std::vector<Name>{data->getFullName()});
+  BOOST_CHECK(findAllMatches(*util::makeData("/A/B/C")).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  auto a1 = insert(Interest("/A"));
+  auto a2 = insert(Interest("/A"));
+  insert(Interest("/A/B"));
+
+  bool isEmpty = false;
+  table.onEmpty.connect([&] { isEmpty = true; });
+
+  table.erase(a1);
+  BOOST_CHECK_EQUAL(findAllMatches(*util::makeData("/A/B/C")).size(), 2);
+
+  table.remove_if([&] (const shared_ptr<PendingInterest>& entry) {
+      return entry->getInterest().getName() == "/A/B";
+    });
+  BOOST_CHECK_EQUAL(findAllMatches(*util::makeData("/A/B/C")).size(), 1);
+  BOOST_CHECK_EQUAL(isEmpty, false);
+
+  table.erase(a2);
+  BOOST_CHECK(findAllMatches(*util::makeData("/A/B/C")).empty());
+  BOOST_CHECK_EQUAL(isEmpty, true);
+
+  insert(Interest("/A"));
+  table.clear();
+  BOOST_CHECK(findAllMatches(*util::makeData("/A")).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
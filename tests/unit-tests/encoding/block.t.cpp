@@ -559,6 +559,66 @@ BOOST_AUTO_TEST_CASE(Remove)
   BOOST_CHECK(readString(elements[1]).compare("ndn:/test-prefix") == 0);
 }
 
+BOOST_AUTO_TEST_CASE(Parse)
+{
+  const uint8_t BUFFER[] = {
+    0x06, 0x0a,
+          0x07, 0x03, 0x08, 0x01, 0x41,
+          0x14, 0x00,
+          0x15, 0x01, 0x42
+  };
+
+  Block block(BUFFER, sizeof(BUFFER));
+  BOOST_REQUIRE_NO_THROW(block.parse());
+  BOOST_REQUIRE_EQUAL(block.elements_size(), 3);
+  BOOST_CHECK_EQUAL(block.elements()[0].type(), tlv::Name);
+  BOOST_CHECK_EQUAL(block.elements()[0].size(), 5);
+  BOOST_CHECK_EQUAL(block.elements()[1].type(), tlv::MetaInfo);
+  BOOST_CHECK_EQUAL(block.elements()[1].value_size(), 0);
+  BOOST_CHECK_EQUAL(block.elements()[2].type(), tlv::Content);
+  BOOST_CHECK_EQUAL(*block.elements()[2].value(), 0x42);
+  // all elements are stored in a single allocation
+  BOOST_CHECK_EQUAL(block.elements().capacity(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(ParseMalformed)
+{
+  const uint8_t BUFFER[] = {
+    0x06, 0x07,
+          0x07, 0x03, 0x08, 0x01, 0x41,
+          0x15, 0x02, // element exceeds enclosing block
+  };
+
+  Block block(BUFFER, sizeof(BUFFER));
+  BOOST_CHECK_THROW(block.parse(), tlv::Error);
+  BOOST_CHECK_EQUAL(block.elements_size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(EncodeNested)
+{
+  Block name(tlv::Name);
+  name.push_back(makeStringBlock(tlv::NameComponent, "A"));
+  name.push_back(makeStringBlock(tlv::NameComponent, "BC"));
+
+  // sub-element without wire is encoded recursively
+  Block data(tlv::Data);
+  data.push_back(name);
+  data.push_back(Block(tlv::MetaInfo));
+  data.push_back(makeNonNegativeIntegerBlock(tlv::FreshnessPeriod, 1));
+  data.encode();
+
+  const uint8_t EXPECTED[] = {
+    0x06, 0x0e,
+          0x07, 0x07, 0x08, 0x01, 0x41, 0x08, 0x02, 0x42, 0x43,
+          0x14, 0x00,
+          0x19, 0x01, 0x01
+  };
+  BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(), EXPECTED, EXPECTED + sizeof(EXPECTED));
+  BOOST_CHECK_EQUAL(data.value_size(), sizeof(EXPECTED) - 2);
+  // the wire is written into a buffer of the exact size
+  BOOST_CHECK_EQUAL(data.getBuffer()->size(), sizeof(EXPECTED));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -275,6 +275,32 @@ BOOST_AUTO_TEST_CASE(ReadFromStream)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ReadFromBufferIterator)
+{
+  Buffer buffer(BUFFER, sizeof(BUFFER));
+  Buffer::const_iterator begin = buffer.begin();
+  uint64_t value = 0;
+
+  BOOST_CHECK(readVarNumber(begin, buffer.cend(), value));
+  BOOST_CHECK_EQUAL(value, 1);
+  BOOST_CHECK(readVarNumber(begin, buffer.cend(), value));
+  BOOST_CHECK_EQUAL(value, 252);
+  BOOST_CHECK(readVarNumber(begin, buffer.cend(), value));
+  BOOST_CHECK_EQUAL(value, 253);
+  BOOST_CHECK(readVarNumber(begin, buffer.cend(), value));
+  BOOST_CHECK_EQUAL(value, 65536);
+  BOOST_CHECK(readVarNumber(begin, buffer.cend(), value));
+  BOOST_CHECK_EQUAL(value, 4294967296LL);
+  BOOST_CHECK(begin == buffer.cend());
+  BOOST_CHECK(!readVarNumber(begin, buffer.cend(), value));
+
+  // truncated multi-octet number is not consumed
+  begin = buffer.begin() + 10;
+  Buffer::const_iterator end = buffer.end() - 1;
+  BOOST_CHECK(!readVarNumber(begin, end, value));
+  BOOST_CHECK(begin == buffer.begin() + 10);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // VarNumber
 
 BOOST_AUTO_TEST_SUITE(NonNegativeInteger)
@@ -409,6 +435,46 @@ BOOST_AUTO_TEST_CASE(ReadFromStream)
 
 BOOST_AUTO_TEST_SUITE_END() // NonNegativeInteger
 
+BOOST_AUTO_TEST_CASE(SplitElements)
+{
+  static const uint8_t ELEMENTS[] = {
+    0x08, 0x01, 0x41, // 1-octet TLV-TYPE and TLV-LENGTH
+    0xfd, 0x01, 0x00, 0x00, // 3-octet TLV-TYPE, empty value
+    0x15, 0xfd, 0x00, 0x02, 0x42, 0x43, // 3-octet TLV-LENGTH
+    0x07, 0x05, 0x08, 0x03 // incomplete
+  };
+
+  std::vector<std::tuple<uint32_t, size_t, size_t, size_t>> elements;
+  const uint8_t* end = splitElements(ELEMENTS, ELEMENTS + sizeof(ELEMENTS),
+    [&] (uint32_t type, const uint8_t* elementBegin, const uint8_t* valueBegin,
+         const uint8_t* elementEnd) {
+      elements.push_back(std::make_tuple(type, elementBegin - ELEMENTS, valueBegin - ELEMENTS,
+                                         elementEnd - ELEMENTS));
+    });
+
+  BOOST_CHECK(end == ELEMENTS + 13);
+  BOOST_REQUIRE_EQUAL(elements.size(), 3);
+  BOOST_CHECK(elements[0] == std::make_tuple(0x08, 0, 2, 3));
+  BOOST_CHECK(elements[1] == std::make_tuple(0x100, 3, 7, 7));
+  BOOST_CHECK(elements[2] == std::make_tuple(0x15, 7, 11, 13));
+
+  elements.clear();
+  end = splitElements(ELEMENTS, ELEMENTS + 13,
+    [&] (uint32_t type, const uint8_t*, const uint8_t*, const uint8_t*) {
+      elements.push_back(std::make_tuple(type, 0, 0, 0));
+    });
+  BOOST_CHECK(end == ELEMENTS + 13);
+  BOOST_CHECK_EQUAL(elements.size(), 3);
+
+  // TLV-TYPE that exceeds 2^32-1 stops the scan
+  static const uint8_t LARGE_TYPE[] = {
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00
+  };
+  end = splitElements(LARGE_TYPE, LARGE_TYPE + sizeof(LARGE_TYPE),
+    [] (uint32_t, const uint8_t*, const uint8_t*, const uint8_t*) { BOOST_ERROR("unexpected"); });
+  BOOST_CHECK(end == LARGE_TYPE);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // EncodingTlv
 
 } // namespace tests
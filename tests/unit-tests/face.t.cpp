@@ -524,6 +524,50 @@ BOOST_AUTO_TEST_CASE(ReceiveDataWithLocalControlHeader)
   advanceClocks(time::milliseconds(10), 100);
 }
 
+BOOST_AUTO_TEST_CASE(PutDataOverloads)
+{
+  // a Data packet that is not owned by a shared_ptr has to be copied
+  Data onStack(*util::makeData("/Hello/World/1"));
+  face->putData(onStack);
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  // a Data packet owned by a shared_ptr is not copied, even if passed by reference
+  shared_ptr<Data> shared = util::makeData("/Hello/World/2");
+  face->putData(static_cast<const Data&>(*shared));
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  face->putData(make_shared<Data>(*util::makeData("/Hello/World/3")));
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  face->putData(Data(*util::makeData("/Hello/World/4")));
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  face->putData(onStack);
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(PutBeadOverloads)
+{
+  // a Bead that is not owned by a shared_ptr has to be copied
+  Bead onStack("/Hello/Bead/1");
+  face->putBead(onStack);
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  // a Bead owned by a shared_ptr is not copied, even if passed by reference
+  shared_ptr<Bead> shared = make_shared<Bead>("/Hello/Bead/2");
+  face->putBead(static_cast<const Bead&>(*shared));
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  face->putBead(make_shared<Bead>("/Hello/Bead/3"));
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  face->putBead(Bead("/Hello/Bead/4"));
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 1);
+
+  face->putBead(onStack);
+  BOOST_CHECK_EQUAL(face->getNCopiedPackets(), 2);
+}
+
 BOOST_AUTO_TEST_CASE(DestructionWithoutCancellingPendingInterests) // Bug #2518
 {
   face->expressInterest(Interest("/Hello/World", time::milliseconds(50)),
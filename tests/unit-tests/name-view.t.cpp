@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "name-view.hpp"
+
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestNameView)
+
+static_assert(std::is_convertible<const Name&, NameView>::value,
+              "NameView must be implicitly convertible from Name");
+static_assert(!std::is_constructible<NameView, Name&&>::value,
+              "NameView must not be constructible from a temporary Name");
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  Name name("/A/B/C/D");
+  NameView view(name);
+  BOOST_CHECK_EQUAL(view.size(), 4);
+  BOOST_CHECK(!view.empty());
+  BOOST_CHECK_EQUAL(view[0], name::Component("A"));
+  BOOST_CHECK_EQUAL(view[-1], name::Component("D"));
+  BOOST_CHECK_EQUAL(view.at(1), name::Component("B"));
+  BOOST_CHECK_THROW(view.at(4), Name::Error);
+  BOOST_CHECK_THROW(view.at(-5), Name::Error);
+  BOOST_CHECK_EQUAL(view.toUri(), "/A/B/C/D");
+  BOOST_CHECK_EQUAL(view.toName(), name);
+
+  // the view refers to the components of the Name
+  BOOST_CHECK(view.begin() == name.begin());
+  BOOST_CHECK(view.end() == name.end());
+
+  NameView empty;
+  BOOST_CHECK(empty.empty());
+  BOOST_CHECK_EQUAL(empty.toUri(), "/");
+  BOOST_CHECK_EQUAL(empty.toName(), Name());
+}
+
+BOOST_AUTO_TEST_CASE(SubName)
+{
+  Name name("/first/second/last");
+  NameView view(name);
+
+  BOOST_CHECK_EQUAL(view.getSubName(1).toUri(), "/second/last");
+  BOOST_CHECK_EQUAL(view.getSubName(0, 2).toUri(), "/first/second");
+  BOOST_CHECK_EQUAL(view.getSubName(-1).toUri(), "/last");
+  BOOST_CHECK_EQUAL(view.getSubName(-10).toUri(), "/first/second/last");
+  BOOST_CHECK_EQUAL(view.getSubName(10).toUri(), "/");
+  BOOST_CHECK_EQUAL(view.getSubName(10, 10).toUri(), "/");
+  BOOST_CHECK_EQUAL(view.getSubName(1, 10).toUri(), "/second/last");
+  BOOST_CHECK_EQUAL(view.getSubName(-10, 2).toUri(), "/first/second");
+  BOOST_CHECK_EQUAL(view.getPrefix(2).toUri(), "/first/second");
+  BOOST_CHECK_EQUAL(view.getPrefix(-1).toUri(), "/first/second");
+  BOOST_CHECK_EQUAL(view.getPrefix(0).toUri(), "/");
+
+  // same as Name::getSubName
+  for (ssize_t start = -4; start <= 4; ++start) {
+    for (size_t count : {size_t(0), size_t(1), size_t(2), size_t(5), Name::npos}) {
+      BOOST_CHECK_EQUAL(view.getSubName(start, count).toName(), name.getSubName(start, count));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Compare)
+{
+  Name name("/A/B/C");
+  NameView view(name);
+
+  BOOST_CHECK(view.getPrefix(2).isPrefixOf(name));
+  BOOST_CHECK(view.getPrefix(2).isPrefixOf(view));
+  BOOST_CHECK(!view.isPrefixOf(view.getPrefix(2)));
+  BOOST_CHECK(NameView().isPrefixOf(view));
+  BOOST_CHECK(Name("/A/B").isPrefixOf(view.getPrefix(2)));
+  BOOST_CHECK(!Name("/A/C").isPrefixOf(view));
+  BOOST_CHECK(!view.getSubName(1).isPrefixOf(name));
+
+  Name other("/X/A/B/C/Y");
+  NameView otherView = NameView(other).getSubName(1, 3);
+  BOOST_CHECK(view == otherView);
+  BOOST_CHECK(view == name);
+  BOOST_CHECK(view.getPrefix(2) != name);
+
+  std::vector<Name> names = {"/", "/A", "/A/B", "/A/C", "/B", "/AA", "/%00"};
+  for (const Name& lhs : names) {
+    for (const Name& rhs : names) {
+      BOOST_CHECK_EQUAL(NameView(lhs).compare(rhs) < 0, lhs.compare(rhs) < 0);
+      BOOST_CHECK_EQUAL(NameView(lhs).compare(rhs) == 0, lhs.compare(rhs) == 0);
+      BOOST_CHECK_EQUAL(NameView(lhs) < NameView(rhs), lhs < rhs);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  Name name("/A/B/C/D");
+  NameView view(name);
+  std::vector<size_t> prefixHashes = name.getPrefixHashes();
+  for (size_t i = 0; i <= name.size(); ++i) {
+    BOOST_CHECK_EQUAL(view.getPrefix(i).getHash(), prefixHashes[i]);
+    BOOST_CHECK_EQUAL(std::hash<NameView>()(view.getPrefix(i)),
+                      std::hash<Name>()(name.getPrefix(i)));
+  }
+
+  Name other("/X/A/B");
+  BOOST_CHECK_EQUAL(NameView(other).getSubName(1).getHash(), view.getPrefix(2).getHash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -170,6 +170,40 @@ BOOST_AUTO_TEST_CASE(ZeroLengthComponent)
   BOOST_CHECK(name2Encoded == nameBlock);
 }
 
+BOOST_AUTO_TEST_CASE(UriRoundTrip)
+{
+  Name name;
+  name.append("generic")
+      .append(name::Component(std::string("\x00 /%.\xFF", 6)))
+      .append(name::Component("..."))
+      .append(name::Component(""))
+      .appendSegment(42)
+      .appendVersion(1)
+      .appendImplicitSha256Digest(make_shared<Buffer>(32));
+
+  std::string uri = name.toUri();
+  BOOST_CHECK_EQUAL(uri, "/generic/%00%20%2F%25.%FF/....../.../%00%2A/%FD%01"
+                         "/sha256digest=0000000000000000000000000000000000000000000000000000000000000000");
+
+  std::ostringstream os;
+  os << name;
+  BOOST_CHECK_EQUAL(os.str(), uri);
+
+  BOOST_CHECK_EQUAL(Name(uri), name);
+  BOOST_CHECK_EQUAL(Name("ndn:" + uri), name);
+  BOOST_CHECK_EQUAL(Name(" ndn://authority" + uri + "/ "), name);
+
+  // a component longer than the stack buffers
+  Name longName;
+  longName.append(name::Component(std::string(1000, '\x80')));
+  BOOST_CHECK_EQUAL(Name(longName.toUri()), longName);
+
+  BOOST_CHECK_THROW(Name("/sha256digest=00"), name::Component::Error);
+  BOOST_CHECK_THROW(Name("/sha256digest=zz00000000000000000000000000000000000000000000000000000000000000"),
+                    name::Component::Error);
+  BOOST_CHECK_THROW(Name("/a/../b"), name::Component::Error);
+}
+
 BOOST_AUTO_TEST_CASE(AppendNumber)
 {
   Name name;
@@ -559,6 +593,55 @@ BOOST_AUTO_TEST_CASE(SubNameOutOfRangeIndexes)
   BOOST_CHECK_EQUAL("/first/second/last", name.getSubName(-10, 10));
 }
 
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  std::hash<Name> hasher;
+
+  // equal names have equal hash values, regardless of how they were created
+  Name fromUri("/hello/world");
+  Name fromWire(fromUri.wireEncode());
+  Name fromAppend;
+  fromAppend.append("hello");
+  // component without wire encoding
+  static const uint8_t WORLD[] = {'w', 'o', 'r', 'l', 'd'};
+  fromAppend.append(Block(tlv::NameComponent, make_shared<Buffer>(WORLD, sizeof(WORLD))));
+  BOOST_CHECK_EQUAL(hasher(fromUri), hasher(fromWire));
+  BOOST_CHECK_EQUAL(hasher(fromUri), hasher(fromAppend));
+  BOOST_CHECK_EQUAL(hasher(fromUri), fromUri.getHash());
+
+  // appending a component updates the cached hash
+  Name name("/hello");
+  size_t prefixHash = hasher(name);
+  name.append("world");
+  BOOST_CHECK_NE(hasher(name), prefixHash);
+  BOOST_CHECK_EQUAL(hasher(name), hasher(fromUri));
+
+  // replacing the components invalidates the cached hash
+  name.clear();
+  BOOST_CHECK_EQUAL(hasher(name), hasher(Name()));
+  name.append("other");
+  BOOST_CHECK_EQUAL(hasher(name), hasher(Name("/other")));
+  name.wireDecode(fromUri.wireEncode());
+  BOOST_CHECK_EQUAL(hasher(name), hasher(fromUri));
+  name = Name("/A");
+  BOOST_CHECK_EQUAL(hasher(name), hasher(Name("/A")));
+
+  // component type is part of the hash
+  BOOST_CHECK_NE(hasher(Name("/sha256digest=" + std::string(64, '0'))),
+                 hasher(Name("/" + std::string(32, '\0'))));
+}
+
+BOOST_AUTO_TEST_CASE(PrefixHashes)
+{
+  Name name("/A/B/C/D/E");
+  std::vector<size_t> hashes = name.getPrefixHashes();
+  BOOST_REQUIRE_EQUAL(hashes.size(), name.size() + 1);
+  for (size_t i = 0; i <= name.size(); ++i) {
+    BOOST_CHECK_EQUAL(hashes[i], std::hash<Name>()(name.getPrefix(i)));
+  }
+  BOOST_CHECK_EQUAL(hashes.back(), name.getHash());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -417,6 +417,61 @@ BOOST_AUTO_TEST_CASE(GeneralSigningInterface)
                                                                 interest5.getName()[-1].blockFromValue()))));
 }
 
+BOOST_AUTO_TEST_CASE(PrepareSigningContext)
+{
+  KeyChain keyChain;
+  Name id("/id");
+  Name certName = keyChain.createIdentity(id);
+  shared_ptr<IdentityCertificate> idCert = keyChain.getCertificate(certName);
+  SigningInfo params(SigningInfo::SIGNER_TYPE_ID, id);
+
+  security::SigningContext context = keyChain.prepareSigningContext(params);
+
+  Data data1("/data1");
+  keyChain.sign(data1, context);
+  BOOST_CHECK(Validator::verifySignature(data1, idCert->getPublicKeyInfo()));
+  BOOST_CHECK_EQUAL(data1.getSignature().getKeyLocator().getName(), certName.getPrefix(-1));
+
+  Interest interest1("/interest1");
+  keyChain.sign(interest1, context);
+  BOOST_CHECK(Validator::verifySignature(interest1, idCert->getPublicKeyInfo()));
+
+  // a default changed directly in the PIB is used by sign(Data&, SigningInfo) right away
+  Name keyName = keyChain.generateEcdsaKeyPair(id, false);
+  shared_ptr<IdentityCertificate> cert = keyChain.selfSign(keyName);
+  keyChain.addCertificate(*cert);
+  keyChain.getPib().setDefaultCertificateNameForKey(cert->getName());
+  keyChain.getPib().setDefaultKeyNameForIdentity(keyName);
+
+  Data data2("/data2");
+  keyChain.sign(data2, params);
+  BOOST_CHECK(Validator::verifySignature(data2, cert->getPublicKeyInfo()));
+  BOOST_CHECK_EQUAL(data2.getSignature().getKeyLocator().getName(),
+                    cert->getName().getPrefix(-1));
+
+  // a prepared context keeps the key it was prepared with
+  Data data3("/data3");
+  keyChain.sign(data3, context);
+  BOOST_CHECK(Validator::verifySignature(data3, idCert->getPublicKeyInfo()));
+  BOOST_CHECK_EQUAL(data3.getSignature().getKeyLocator().getName(), certName.getPrefix(-1));
+
+  // until a new one is prepared
+  context = keyChain.prepareSigningContext(params);
+  Data data4("/data4");
+  keyChain.sign(data4, context);
+  BOOST_CHECK(Validator::verifySignature(data4, cert->getPublicKeyInfo()));
+  BOOST_CHECK_EQUAL(data4.getSignature().getKeyLocator().getName(),
+                    cert->getName().getPrefix(-1));
+
+  security::SigningContext sha256Context =
+    keyChain.prepareSigningContext(SigningInfo(SigningInfo::SIGNER_TYPE_SHA256));
+  Data data5("/data5");
+  keyChain.sign(data5, sha256Context);
+  BOOST_CHECK(Validator::verifySignature(data5, DigestSha256(data5.getSignature())));
+
+  keyChain.deleteIdentity(id);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
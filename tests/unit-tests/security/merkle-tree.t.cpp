@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "security/merkle-tree.hpp"
+
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace security {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(SecurityMerkleTree)
+
+static std::vector<ConstBufferPtr>
+makeLeafHashes(size_t nLeaves)
+{
+  std::vector<ConstBufferPtr> leafHashes;
+  for (size_t i = 0; i < nLeaves; ++i) {
+    uint8_t leaf = static_cast<uint8_t>(i);
+    leafHashes.push_back(MerkleTree::hashLeaf(&leaf, 1));
+  }
+  return leafHashes;
+}
+
+BOOST_AUTO_TEST_CASE(Shape)
+{
+  BOOST_CHECK_THROW(MerkleTree(std::vector<ConstBufferPtr>()), MerkleTree::Error);
+
+  std::vector<ConstBufferPtr> leafHashes = makeLeafHashes(5);
+
+  MerkleTree single({leafHashes[0]});
+  BOOST_CHECK(*single.getRoot() == *leafHashes[0]);
+  BOOST_CHECK(single.getPath(0).empty());
+
+  // RFC 6962: MTH(d0..d4) = H(0x01 || MTH(d0..d3) || MTH(d4))
+  MerkleTree tree(leafHashes);
+  ConstBufferPtr left = MerkleTree::hashChildren(
+    *MerkleTree::hashChildren(*leafHashes[0], *leafHashes[1]),
+    *MerkleTree::hashChildren(*leafHashes[2], *leafHashes[3]));
+  BOOST_CHECK_EQUAL(tree.getLeafCount(), 5);
+  BOOST_CHECK(*tree.getRoot() == *MerkleTree::hashChildren(*left, *leafHashes[4]));
+
+  std::vector<ConstBufferPtr> path = tree.getPath(4);
+  BOOST_REQUIRE_EQUAL(path.size(), 1);
+  BOOST_CHECK(*path[0] == *left);
+  BOOST_CHECK_EQUAL(tree.getPath(0).size(), 3);
+  BOOST_CHECK_THROW(tree.getPath(5), MerkleTree::Error);
+
+  // leaves and interior nodes are hashed differently
+  Buffer children(*leafHashes[0]);
+  children.insert(children.end(), leafHashes[1]->begin(), leafHashes[1]->end());
+  BOOST_CHECK(*MerkleTree::hashLeaf(children.buf(), children.size()) !=
+              *MerkleTree::hashChildren(*leafHashes[0], *leafHashes[1]));
+}
+
+BOOST_AUTO_TEST_CASE(InclusionProof)
+{
+  for (size_t nLeaves = 1; nLeaves <= 33; ++nLeaves) {
+    std::vector<ConstBufferPtr> leafHashes = makeLeafHashes(nLeaves);
+    MerkleTree tree(leafHashes);
+
+    for (size_t i = 0; i < nLeaves; ++i) {
+      std::vector<ConstBufferPtr> path = tree.getPath(i);
+      ConstBufferPtr root = MerkleTree::computeRoot(leafHashes[i], i, nLeaves, path);
+      BOOST_REQUIRE(root != nullptr);
+      BOOST_CHECK(*root == *tree.getRoot());
+
+      BOOST_CHECK(MerkleTree::computeRoot(leafHashes[i], nLeaves, nLeaves, path) == nullptr);
+
+      if (nLeaves > 1) {
+        ConstBufferPtr wrongLeaf = leafHashes[(i + 1) % nLeaves];
+        root = MerkleTree::computeRoot(wrongLeaf, i, nLeaves, path);
+        BOOST_CHECK(root == nullptr || *root != *tree.getRoot());
+
+        path.pop_back();
+        root = MerkleTree::computeRoot(leafHashes[i], i, nLeaves, path);
+        BOOST_CHECK(root == nullptr || *root != *tree.getRoot());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace security
+} // namespace ndn
@@ -291,6 +291,159 @@ BOOST_AUTO_TEST_CASE(EcdsaSigning)
 }
 
 
+BOOST_AUTO_TEST_CASE(ReplaceLoadedKey)
+{
+  SecTpmFile tpm;
+
+  Name keyName("/TestSecTpmFile/ReplaceLoadedKey/ksk-" +
+               boost::lexical_cast<std::string>(time::toUnixTimestamp(time::system_clock::now())));
+  BOOST_CHECK_NO_THROW(tpm.generateKeyPairInTpm(keyName, RsaKeyParams(2048)));
+
+  const uint8_t content[] = {0x01, 0x02, 0x03, 0x04};
+  BOOST_CHECK_NO_THROW(tpm.signInTpm(content, sizeof(content), keyName, DIGEST_ALGORITHM_SHA256));
+
+  // the loaded key is dropped together with the key pair
+  tpm.deleteKeyPairInTpm(keyName);
+  BOOST_CHECK_THROW(tpm.signInTpm(content, sizeof(content), keyName, DIGEST_ALGORITHM_SHA256),
+                    SecTpmFile::Error);
+
+  // a new key pair with the same name is used to sign
+  BOOST_CHECK_NO_THROW(tpm.generateKeyPairInTpm(keyName, EcdsaKeyParams()));
+  Block sigBlock;
+  BOOST_CHECK_NO_THROW(sigBlock = tpm.signInTpm(content, sizeof(content),
+                                                keyName, DIGEST_ALGORITHM_SHA256));
+  shared_ptr<PublicKey> pubkeyPtr;
+  BOOST_CHECK_NO_THROW(pubkeyPtr = tpm.getPublicKeyFromTpm(keyName));
+
+  try
+    {
+      using namespace CryptoPP;
+
+      ECDSA<ECP, SHA256>::PublicKey publicKey;
+      ByteQueue queue;
+      queue.Put(reinterpret_cast<const byte*>(pubkeyPtr->get().buf()), pubkeyPtr->get().size());
+      publicKey.Load(queue);
+
+      uint8_t buffer[64];
+      size_t usedSize = DSAConvertSignatureFormat(buffer, 64, DSA_P1363,
+                                                  sigBlock.value(), sigBlock.value_size(), DSA_DER);
+
+      ECDSA<ECP, SHA256>::Verifier verifier(publicKey);
+      bool result = verifier.VerifyMessage(content, sizeof(content),
+                                           buffer, usedSize);
+
+      BOOST_CHECK_EQUAL(result, true);
+    }
+  catch (CryptoPP::Exception& e)
+    {
+      BOOST_CHECK(false);
+    }
+
+  tpm.deleteKeyPairInTpm(keyName);
+}
+
+BOOST_AUTO_TEST_CASE(KeyChangedByAnotherTpm)
+{
+  SecTpmFile tpm;
+  SecTpmFile otherTpm;
+
+  Name keyName("/TestSecTpmFile/KeyChangedByAnotherTpm/ksk-" +
+               boost::lexical_cast<std::string>(time::toUnixTimestamp(time::system_clock::now())));
+  BOOST_CHECK_NO_THROW(tpm.generateKeyPairInTpm(keyName, EcdsaKeyParams()));
+
+  const uint8_t content[] = {0x01, 0x02, 0x03, 0x04};
+  BOOST_CHECK_NO_THROW(tpm.signInTpm(content, sizeof(content), keyName, DIGEST_ALGORITHM_SHA256));
+
+  // the loaded key is not used after another SecTpmFile replaced the key pair
+  otherTpm.deleteKeyPairInTpm(keyName);
+  BOOST_CHECK_NO_THROW(otherTpm.generateKeyPairInTpm(keyName, RsaKeyParams(2048)));
+  Block sigBlock;
+  BOOST_CHECK_NO_THROW(sigBlock = tpm.signInTpm(content, sizeof(content),
+                                                keyName, DIGEST_ALGORITHM_SHA256));
+  shared_ptr<PublicKey> publicKey;
+  BOOST_CHECK_NO_THROW(publicKey = tpm.getPublicKeyFromTpm(keyName));
+
+  try
+    {
+      using namespace CryptoPP;
+
+      RSA::PublicKey rsaPublicKey;
+      ByteQueue queue;
+      queue.Put(reinterpret_cast<const byte*>(publicKey->get().buf()), publicKey->get().size());
+      rsaPublicKey.Load(queue);
+
+      RSASS<PKCS1v15, SHA256>::Verifier verifier(rsaPublicKey);
+      bool result = verifier.VerifyMessage(content, sizeof(content),
+                                           sigBlock.value(), sigBlock.value_size());
+
+      BOOST_CHECK_EQUAL(result, true);
+    }
+  catch (CryptoPP::Exception& e)
+    {
+      BOOST_CHECK(false);
+    }
+
+  // the loaded key is not used after another SecTpmFile deleted the key pair
+  otherTpm.deleteKeyPairInTpm(keyName);
+  BOOST_CHECK_THROW(tpm.signInTpm(content, sizeof(content), keyName, DIGEST_ALGORITHM_SHA256),
+                    SecTpmFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(KeyRewrittenInPlace)
+{
+  SecTpmFile tpm;
+  SecTpmFile otherTpm;
+
+  std::string timestamp =
+    boost::lexical_cast<std::string>(time::toUnixTimestamp(time::system_clock::now()));
+  Name keyName("/TestSecTpmFile/KeyRewrittenInPlace/ksk-" + timestamp);
+  Name otherKeyName("/TestSecTpmFile/KeyRewrittenInPlace/other-ksk-" + timestamp);
+  BOOST_CHECK_NO_THROW(tpm.generateKeyPairInTpm(keyName, EcdsaKeyParams()));
+  BOOST_CHECK_NO_THROW(otherTpm.generateKeyPairInTpm(otherKeyName, EcdsaKeyParams()));
+
+  const uint8_t content[] = {0x01, 0x02, 0x03, 0x04};
+  BOOST_CHECK_NO_THROW(tpm.signInTpm(content, sizeof(content), keyName, DIGEST_ALGORITHM_SHA256));
+
+  // right away, another SecTpmFile rewrites the key files in place with a key of the same size
+  ConstBufferPtr exported;
+  BOOST_REQUIRE_NO_THROW(exported = otherTpm.exportPrivateKeyPkcs5FromTpm(otherKeyName, "1234"));
+  BOOST_REQUIRE(otherTpm.importPrivateKeyPkcs5IntoTpm(keyName, exported->buf(), exported->size(),
+                                                      "1234"));
+
+  Block sigBlock;
+  BOOST_CHECK_NO_THROW(sigBlock = tpm.signInTpm(content, sizeof(content),
+                                                keyName, DIGEST_ALGORITHM_SHA256));
+  shared_ptr<PublicKey> pubkeyPtr;
+  BOOST_CHECK_NO_THROW(pubkeyPtr = otherTpm.getPublicKeyFromTpm(otherKeyName));
+
+  try
+    {
+      using namespace CryptoPP;
+
+      ECDSA<ECP, SHA256>::PublicKey publicKey;
+      ByteQueue queue;
+      queue.Put(reinterpret_cast<const byte*>(pubkeyPtr->get().buf()), pubkeyPtr->get().size());
+      publicKey.Load(queue);
+
+      uint8_t buffer[64];
+      size_t usedSize = DSAConvertSignatureFormat(buffer, 64, DSA_P1363,
+                                                  sigBlock.value(), sigBlock.value_size(), DSA_DER);
+
+      ECDSA<ECP, SHA256>::Verifier verifier(publicKey);
+      bool result = verifier.VerifyMessage(content, sizeof(content),
+                                           buffer, usedSize);
+
+      BOOST_CHECK_EQUAL(result, true);
+    }
+  catch (CryptoPP::Exception& e)
+    {
+      BOOST_CHECK(false);
+    }
+
+  tpm.deleteKeyPairInTpm(keyName);
+  otherTpm.deleteKeyPairInTpm(otherKeyName);
+}
+
 BOOST_AUTO_TEST_CASE(ImportExportEcdsaKey)
 {
   using namespace CryptoPP;
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "security/signature-sha256-with-merkle.hpp"
+#include "security/key-chain.hpp"
+#include "security/validator.hpp"
+#include "identity-management-fixture.hpp"
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(SecuritySignatureSha256WithMerkle, security::IdentityManagementFixture)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  SignatureSha256WithMerkle sig(KeyLocator(Name("/test/key/locator")));
+  BOOST_CHECK_EQUAL(sig.getType(), tlv::SignatureSha256WithMerkle);
+  BOOST_CHECK_NO_THROW(sig.getKeyLocator());
+
+  std::vector<ConstBufferPtr> path{make_shared<Buffer>(32), make_shared<Buffer>(32)};
+  const uint8_t rootSigBits[] = {0x01, 0x02, 0x03};
+  Block rootSignature = makeBinaryBlock(tlv::SignatureValue, rootSigBits, sizeof(rootSigBits));
+  sig.setValue(SignatureSha256WithMerkle::encodeValue(3, 7, path, rootSignature));
+
+  SignatureSha256WithMerkle decoded(Signature(sig.getInfo(), sig.getValue()));
+  BOOST_CHECK_EQUAL(decoded.getLeafIndex(), 3);
+  BOOST_CHECK_EQUAL(decoded.getLeafCount(), 7);
+  BOOST_REQUIRE_EQUAL(decoded.getPath().size(), 2);
+  BOOST_CHECK(*decoded.getPath()[1] == *path[1]);
+  BOOST_CHECK(decoded.getRootSignature() == rootSignature);
+
+  Signature wrongType(SignatureInfo(tlv::SignatureSha256WithRsa, KeyLocator(Name("/test"))),
+                      sig.getValue());
+  BOOST_CHECK_THROW(SignatureSha256WithMerkle{wrongType}, SignatureSha256WithMerkle::Error);
+
+  Signature noProof(sig.getInfo(), makeBinaryBlock(tlv::SignatureValue, rootSigBits, 3));
+  BOOST_CHECK_THROW(SignatureSha256WithMerkle{noProof}, tlv::Error);
+}
+
+static std::vector<Data>
+makeSegments(size_t nSegments)
+{
+  std::vector<Data> segments;
+  for (size_t i = 0; i < nSegments; ++i) {
+    segments.push_back(Data(Name("/SecurityTestSignatureSha256WithMerkle/object")
+                              .appendSegment(i)));
+    segments.back().setContent(reinterpret_cast<const uint8_t*>("1234"), 4);
+  }
+  return segments;
+}
+
+BOOST_AUTO_TEST_CASE(SignBatch)
+{
+  Name rsaIdentity("/SecurityTestSignatureSha256WithMerkle/Rsa");
+  Name ecdsaIdentity("/SecurityTestSignatureSha256WithMerkle/Ecdsa");
+  BOOST_REQUIRE(addIdentity(rsaIdentity, RsaKeyParams()));
+  BOOST_REQUIRE(addIdentity(ecdsaIdentity, EcdsaKeyParams()));
+  shared_ptr<PublicKey> rsaKey = m_keyChain.getPublicKeyFromTpm(
+    m_keyChain.getDefaultKeyNameForIdentity(rsaIdentity));
+  shared_ptr<PublicKey> ecdsaKey = m_keyChain.getPublicKeyFromTpm(
+    m_keyChain.getDefaultKeyNameForIdentity(ecdsaIdentity));
+
+  for (const Name& identity : {rsaIdentity, ecdsaIdentity}) {
+    const PublicKey& key = identity == rsaIdentity ? *rsaKey : *ecdsaKey;
+    const PublicKey& otherKey = identity == rsaIdentity ? *ecdsaKey : *rsaKey;
+
+    std::vector<Data> segments = makeSegments(11);
+    m_keyChain.signBatch(segments, security::SigningInfo(security::SigningInfo::SIGNER_TYPE_ID,
+                                                         identity));
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+      Data decoded(segments[i].wireEncode());
+      BOOST_CHECK_EQUAL(decoded.getSignature().getType(), tlv::SignatureSha256WithMerkle);
+      BOOST_CHECK_EQUAL(decoded.getSignature().getKeyLocator().getName(),
+                        m_keyChain.getDefaultCertificateNameForIdentity(identity).getPrefix(-1));
+      SignatureSha256WithMerkle sig(decoded.getSignature());
+      BOOST_CHECK_EQUAL(sig.getLeafIndex(), i);
+      BOOST_CHECK_EQUAL(sig.getLeafCount(), segments.size());
+
+      BOOST_CHECK(Validator::verifySignature(decoded, key));
+      BOOST_CHECK(!Validator::verifySignature(decoded, otherKey));
+    }
+
+    // a proof does not verify another packet of the batch
+    Data swapped(segments[1]);
+    swapped.setSignature(segments[2].getSignature());
+    BOOST_CHECK(!Validator::verifySignature(swapped, key));
+
+    // a modified packet does not verify
+    Data modified(segments[3]);
+    modified.setContent(reinterpret_cast<const uint8_t*>("4321"), 4);
+    BOOST_CHECK(!Validator::verifySignature(modified, key));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SignBatchSha256)
+{
+  std::vector<Data> segments = makeSegments(3);
+  m_keyChain.signBatch(segments,
+                       security::SigningInfo(security::SigningInfo::SIGNER_TYPE_SHA256));
+
+  for (const Data& data : segments) {
+    BOOST_CHECK_EQUAL(data.getSignature().getType(), tlv::DigestSha256);
+    BOOST_CHECK(Validator::verifySignature(data, DigestSha256(data.getSignature())));
+  }
+
+  std::vector<Data> empty;
+  BOOST_CHECK_NO_THROW(m_keyChain.signBatch(empty));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
@@ -22,7 +22,10 @@
 #include "security/validator-null.hpp"
 #include "security/key-chain.hpp"
 #include "util/time.hpp"
+#include "util/dummy-client-face.hpp"
 #include "identity-management-fixture.hpp"
+#include "../unit-test-time-fixture.hpp"
+#include "../make-interest-data.hpp"
 #include "boost-test.hpp"
 
 namespace ndn {
@@ -236,6 +239,119 @@ BOOST_AUTO_TEST_CASE(EcdsaSignatureVerification2)
   BOOST_CHECK(Validator::verifySignature(*testInterestRsa, rsaCert->getPublicKeyInfo()));
 }
 
+/// accepts Data of type Key as certificates, and requests /cert for any other Data
+class CertificateFetchingValidator : public Validator
+{
+public:
+  explicit
+  CertificateFetchingValidator(Face* face)
+    : Validator(face)
+    , nCertificateChecks(0)
+  {
+  }
+
+protected:
+  virtual void
+  checkPolicy(const Data& data,
+              int nSteps,
+              const OnDataValidated& onValidated,
+              const OnDataValidationFailed& onValidationFailed,
+              std::vector<shared_ptr<ValidationRequest> >& nextSteps)
+  {
+    if (data.getContentType() == tlv::ContentType_Key) {
+      ++nCertificateChecks;
+      return onValidated(data.shared_from_this());
+    }
+
+    shared_ptr<const Data> packet = data.shared_from_this();
+    nextSteps.push_back(make_shared<ValidationRequest>(Interest("/cert"),
+      [=] (const shared_ptr<const Data>&) { onValidated(packet); },
+      [=] (const shared_ptr<const Data>&, const string& failureInfo) {
+        onValidationFailed(packet, failureInfo);
+      },
+      1, nSteps + 1));
+  }
+
+  virtual void
+  checkPolicy(const Interest& interest,
+              int nSteps,
+              const OnInterestValidated& onValidated,
+              const OnInterestValidationFailed& onValidationFailed,
+              std::vector<shared_ptr<ValidationRequest> >& nextSteps)
+  {
+    onValidationFailed(interest.shared_from_this(), "Interests are not supported");
+  }
+
+public:
+  int nCertificateChecks;
+};
+
+class CertificateFetchFixture : public UnitTestTimeFixture
+{
+public:
+  CertificateFetchFixture()
+    : face(util::makeDummyClientFace(io))
+    , validator(face.get())
+    , nValidated(0)
+    , nFailed(0)
+  {
+  }
+
+  void
+  validateMany(size_t nPackets)
+  {
+    for (size_t i = 0; i < nPackets; ++i) {
+      shared_ptr<Data> data = util::makeData(Name("/data").appendNumber(i));
+      validator.validate(*data,
+                         [this] (const shared_ptr<const Data>&) { ++nValidated; },
+                         [this] (const shared_ptr<const Data>&, const string&) { ++nFailed; });
+    }
+  }
+
+public:
+  shared_ptr<util::DummyClientFace> face;
+  CertificateFetchingValidator validator;
+  size_t nValidated;
+  size_t nFailed;
+};
+
+BOOST_FIXTURE_TEST_CASE(CoalesceCertificateFetches, CertificateFetchFixture)
+{
+  validateMany(1000);
+  advanceClocks(time::milliseconds(10));
+
+  BOOST_REQUIRE_EQUAL(face->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(face->sentInterests[0].getName(), "/cert");
+
+  shared_ptr<Data> certificate = make_shared<Data>("/cert");
+  certificate->setContentType(tlv::ContentType_Key);
+  util::signData(certificate);
+  face->receive(*certificate);
+  advanceClocks(time::milliseconds(10));
+
+  BOOST_CHECK_EQUAL(validator.nCertificateChecks, 1);
+  BOOST_CHECK_EQUAL(nValidated, 1000);
+  BOOST_CHECK_EQUAL(nFailed, 0);
+
+  // a later request fetches the certificate again
+  validateMany(1);
+  advanceClocks(time::milliseconds(10));
+  BOOST_CHECK_EQUAL(face->sentInterests.size(), 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(CoalescedCertificateFetchTimeout, CertificateFetchFixture)
+{
+  validateMany(10);
+  advanceClocks(time::milliseconds(10));
+  BOOST_CHECK_EQUAL(face->sentInterests.size(), 1);
+
+  // the Interest is retried once, then every waiting validation fails
+  advanceClocks(time::milliseconds(500), 20);
+  BOOST_CHECK_EQUAL(face->sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(nValidated, 0);
+  BOOST_CHECK_EQUAL(nFailed, 10);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
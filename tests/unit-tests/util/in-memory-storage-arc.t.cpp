@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "util/in-memory-storage-arc.hpp"
+#include "security/key-chain.hpp"
+
+#include "boost-test.hpp"
+#include "../make-interest-data.hpp"
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(UtilInMemoryStorage)
+BOOST_AUTO_TEST_SUITE(Arc)
+
+BOOST_AUTO_TEST_CASE(ScanResistance)
+{
+  InMemoryStorageArc ims(3);
+
+  Name name1("/insert/1");
+  ims.insert(*makeData(name1));
+  ims.find(name1);
+
+  // packets accessed only once are evicted before a packet accessed again
+  for (int i = 2; i < 10; ++i) {
+    ims.insert(*makeData(Name("/insert").appendNumber(i)));
+    BOOST_CHECK_EQUAL(ims.size(), std::min(i, 3));
+  }
+
+  BOOST_CHECK(ims.find(name1) != nullptr);
+  BOOST_CHECK(ims.find(Name("/insert").appendNumber(2)) == nullptr);
+  BOOST_CHECK(ims.find(Name("/insert").appendNumber(9)) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GhostHit)
+{
+  InMemoryStorageArc ims(2);
+
+  Name name1("/insert/1");
+  Name name2("/insert/2");
+  Name name3("/insert/3");
+
+  ims.insert(*makeData(name1));
+  ims.find(name1);
+  ims.insert(*makeData(name2));
+  ims.insert(*makeData(name3));
+  BOOST_CHECK(ims.find(name2) == nullptr);
+  BOOST_CHECK_EQUAL(ims.getRecencyTarget(), 0);
+
+  // reinserting an evicted packet grows the recency target, and the packet is kept as frequent
+  ims.insert(*makeData(name2));
+  BOOST_CHECK_EQUAL(ims.getRecencyTarget(), 1);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(name3) == nullptr);
+
+  ims.evictItem();
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK(ims.find(name1) == nullptr);
+  BOOST_CHECK(ims.find(name2) != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Arc
+BOOST_AUTO_TEST_SUITE_END() // UtilInMemoryStorage
+
+} // namespace tests
+} // namespace util
+} // namespace ndn
@@ -170,6 +170,34 @@ BOOST_AUTO_TEST_CASE(Unescape)
                     "\x01\x2a\x3b\xc4\xde\xfa\xb5\xcd\xef");
 }
 
+BOOST_AUTO_TEST_CASE(UnescapeInPlace)
+{
+  char buffer[] = "a%20b%ZZc%2";
+  size_t size = unescape(buffer, sizeof(buffer) - 1, reinterpret_cast<uint8_t*>(buffer));
+  BOOST_CHECK_EQUAL(std::string(buffer, size), "a b%ZZc%2");
+}
+
+BOOST_AUTO_TEST_CASE(Escape)
+{
+  BOOST_CHECK_EQUAL(escape("hello world"), "hello%20world");
+  BOOST_CHECK_EQUAL(escape("azAZ09+-._"), "azAZ09+-._");
+  BOOST_CHECK_EQUAL(escape(std::string("\x00\x01/%~\xAA\xFF", 7)), "%00%01%2F%25%7E%AA%FF");
+  BOOST_CHECK_EQUAL(escape(""), "");
+
+  // every octet survives a round trip
+  std::string all;
+  for (int i = 0; i < 256; ++i)
+    all.push_back(static_cast<char>(i));
+
+  char escaped[256 * 3];
+  size_t escapedSize = escape(reinterpret_cast<const uint8_t*>(all.data()), all.size(), escaped);
+  BOOST_CHECK_LE(escapedSize, sizeof(escaped));
+
+  uint8_t unescaped[256 * 3];
+  size_t unescapedSize = unescape(escaped, escapedSize, unescaped);
+  BOOST_CHECK(std::string(reinterpret_cast<char*>(unescaped), unescapedSize) == all);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace test
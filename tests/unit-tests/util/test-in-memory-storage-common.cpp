@@ -23,10 +23,12 @@
 #include "util/in-memory-storage-fifo.hpp"
 #include "util/in-memory-storage-lfu.hpp"
 #include "util/in-memory-storage-lru.hpp"
+#include "util/in-memory-storage-arc.hpp"
 #include "security/key-chain.hpp"
 
 #include "boost-test.hpp"
 #include "../make-interest-data.hpp"
+#include "../unit-test-time-fixture.hpp"
 
 #include <boost/mpl/list.hpp>
 
@@ -38,7 +40,7 @@ BOOST_AUTO_TEST_SUITE(UtilInMemoryStorage)
 BOOST_AUTO_TEST_SUITE(Common)
 
 typedef boost::mpl::list<InMemoryStoragePersistent, InMemoryStorageFifo, InMemoryStorageLfu,
-                         InMemoryStorageLru> InMemoryStorages;
+                         InMemoryStorageLru, InMemoryStorageArc> InMemoryStorages;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(Insertion, T, InMemoryStorages)
 {
@@ -159,6 +161,37 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndFindByName, T, InMemoryStorages)
   BOOST_CHECK_EQUAL(data->getName(), found->getName());
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(FindByNameLeftmost, T, InMemoryStorages)
+{
+  T ims;
+
+  Name name("/insert/and/find");
+  std::vector<Name> fullNames;
+  for (uint32_t content = 0; content < 8; ++content) {
+    shared_ptr<Data> data = makeData(name);
+    data->setContent(reinterpret_cast<const uint8_t*>(&content), sizeof(content));
+    signData(data);
+    ims.insert(*data);
+    fullNames.push_back(data->getFullName());
+  }
+  ims.insert(*makeData("/insert/and/find/child"));
+
+  // among several Data packets with the same name, the one with the smallest full name is found
+  shared_ptr<const Data> found = ims.find(name);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getFullName(), *std::min_element(fullNames.begin(), fullNames.end()));
+
+  // with a single Data packet left with that name, the same one is still found
+  for (const Name& fullName : fullNames) {
+    if (fullName != found->getFullName())
+      ims.erase(fullName, false);
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  shared_ptr<const Data> found2 = ims.find(name);
+  BOOST_REQUIRE(found2 != nullptr);
+  BOOST_CHECK_EQUAL(found2->getFullName(), found->getFullName());
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndFindByFullName, T, InMemoryStorages)
 {
   T ims;
@@ -628,8 +661,8 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ExcludeSelector, T, InMemoryStorages)
   BOOST_CHECK_EQUAL(found3->getName(), "/c/a");
 }
 
-typedef boost::mpl::list<InMemoryStorageFifo, InMemoryStorageLfu, InMemoryStorageLru>
-                         InMemoryStoragesLimited;
+typedef boost::mpl::list<InMemoryStorageFifo, InMemoryStorageLfu, InMemoryStorageLru,
+                         InMemoryStorageArc> InMemoryStoragesLimited;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(setCapacity, T, InMemoryStoragesLimited)
 {
@@ -698,6 +731,67 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndEvict, T, InMemoryStoragesLimited)
   BOOST_CHECK(!static_cast<bool>(found));
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(ByteLimit, T, InMemoryStoragesLimited)
+{
+  T ims(std::numeric_limits<size_t>::max());
+
+  std::vector<shared_ptr<Data>> packets;
+  for (size_t i = 0; i < 64; ++i) {
+    shared_ptr<Data> data = makeData(Name("/byte").appendNumber(i));
+    std::vector<uint8_t> content(100 + 100 * (i % 8));
+    data->setContent(content.data(), content.size());
+    packets.push_back(signData(data));
+  }
+
+  const size_t byteLimit = 4 * packets.back()->wireEncode().size();
+  ims.setByteLimit(byteLimit);
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), byteLimit);
+
+  for (const shared_ptr<Data>& data : packets) {
+    ims.insert(*data);
+    BOOST_CHECK_LE(ims.sizeInBytes(), byteLimit);
+    BOOST_CHECK(ims.find(data->getFullName()) != nullptr);
+  }
+  BOOST_CHECK_LT(ims.size(), packets.size());
+  BOOST_CHECK_GT(ims.size(), 4);
+
+  // the byte counter follows every insertion and deletion
+  size_t nBytes = 0;
+  for (const Data& data : ims) {
+    nBytes += data.wireEncode().size();
+  }
+  BOOST_CHECK_EQUAL(ims.sizeInBytes(), nBytes);
+
+  // the memory pool does not grow beyond what the byte limit allows
+  BOOST_CHECK_LE(ims.getCapacity(), 4 * byteLimit / packets.front()->wireEncode().size());
+
+  ims.setByteLimit(byteLimit / 2);
+  BOOST_CHECK_LE(ims.sizeInBytes(), byteLimit / 2);
+
+  // a packet larger than the byte limit is not stored
+  ims.setByteLimit(packets.front()->wireEncode().size() - 1);
+  ims.insert(*packets.front());
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+  BOOST_CHECK_EQUAL(ims.sizeInBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ByteLimitPersistent)
+{
+  InMemoryStoragePersistent ims;
+
+  shared_ptr<Data> data1 = makeData("/persistent/1");
+  shared_ptr<Data> data2 = makeData("/persistent/2");
+  ims.setByteLimit(data1->wireEncode().size() + data2->wireEncode().size() - 1);
+
+  // persistent packets are never evicted, so a packet that does not fit is not stored
+  ims.insert(*data1);
+  ims.insert(*data2);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK_EQUAL(ims.sizeInBytes(), data1->wireEncode().size());
+
+  BOOST_CHECK_THROW(ims.setByteLimit(1), InMemoryStorage::Error);
+}
+
 ///as Find function is implemented at the base case, therefore testing for one derived class is
 ///sufficient for all
 class FindFixture
@@ -976,6 +1070,158 @@ BOOST_AUTO_TEST_CASE(DigestExclude)
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Find
+
+class FreshnessFixture : public ndn::tests::UnitTestTimeFixture
+{
+protected:
+  shared_ptr<Data>
+  makeFreshData(const Name& name, const time::milliseconds& freshnessPeriod)
+  {
+    shared_ptr<Data> data = makeData(name);
+    data->setFreshnessPeriod(freshnessPeriod);
+    return signData(data);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(Freshness, FreshnessFixture)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(MustBeFresh, T, InMemoryStorages)
+{
+  T ims;
+
+  shared_ptr<Data> data1 = makeFreshData("/A/1", time::seconds(1));
+  ims.insert(*data1);
+  shared_ptr<Data> data2 = makeData("/A/2"); // without FreshnessPeriod, never fresh
+  ims.insert(*data2);
+
+  Interest interest("/A");
+  interest.setMustBeFresh(true);
+  shared_ptr<const Data> found = ims.find(interest);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), "/A/1");
+
+  interest.setChildSelector(1);
+  found = ims.find(interest);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), "/A/1");
+
+  Interest fullNameInterest(data1->getFullName());
+  fullNameInterest.setMustBeFresh(true);
+  BOOST_CHECK(ims.find(fullNameInterest) != nullptr);
+
+  advanceClocks(time::milliseconds(500), 3);
+
+  BOOST_CHECK(ims.find(interest) == nullptr);
+  BOOST_CHECK(ims.find(fullNameInterest) == nullptr);
+
+  // stale Data still satisfies Interests without MustBeFresh
+  BOOST_CHECK(ims.find(Interest("/A")) != nullptr);
+  BOOST_CHECK(ims.find(Interest(data1->getFullName())) != nullptr);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EraseStale, T, InMemoryStorages)
+{
+  T ims;
+
+  ims.insert(*makeFreshData("/A", time::seconds(1)));
+  ims.insert(*makeFreshData("/B", time::seconds(2)));
+  ims.insert(*makeData("/C"));
+
+  BOOST_CHECK_EQUAL(ims.eraseStale(), 1);
+  BOOST_CHECK(ims.find(Name("/C")) == nullptr);
+
+  advanceClocks(time::milliseconds(500), 3);
+  BOOST_CHECK_EQUAL(ims.eraseStale(), 1);
+  BOOST_CHECK(ims.find(Name("/A")) == nullptr);
+  BOOST_CHECK(ims.find(Name("/B")) != nullptr);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+
+  advanceClocks(time::milliseconds(500), 2);
+  BOOST_CHECK_EQUAL(ims.eraseStale(), 1);
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ReinsertRefreshes, T, InMemoryStorages)
+{
+  T ims;
+
+  shared_ptr<Data> data = makeFreshData("/A/1", time::seconds(1));
+  ims.insert(*data);
+  ims.insert(*makeFreshData("/B", time::seconds(2)));
+
+  Interest interest("/A");
+  interest.setMustBeFresh(true);
+
+  advanceClocks(time::milliseconds(500), 3);
+  BOOST_CHECK(ims.find(interest) == nullptr);
+
+  // inserting the same Data again makes it fresh for another FreshnessPeriod
+  ims.insert(*data);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  shared_ptr<const Data> found = ims.find(interest);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), "/A/1");
+
+  // /B now becomes stale before /A/1
+  advanceClocks(time::milliseconds(500));
+  BOOST_CHECK_EQUAL(ims.eraseStale(), 1);
+  BOOST_CHECK(ims.find(Name("/B")) == nullptr);
+  BOOST_CHECK(ims.find(interest) != nullptr);
+
+  advanceClocks(time::milliseconds(500));
+  BOOST_CHECK(ims.find(interest) == nullptr);
+  BOOST_CHECK_EQUAL(ims.eraseStale(), 1);
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(PeriodicStaleEviction, T, InMemoryStorages)
+{
+  Scheduler scheduler(io);
+  T ims;
+  ims.enableStaleEviction(scheduler, time::seconds(1));
+
+  ims.insert(*makeFreshData("/A", time::milliseconds(1500)));
+  ims.insert(*makeFreshData("/B", time::seconds(5)));
+  ims.insert(*makeData("/C"));
+
+  // stale Data is erased by the scheduled pass, eraseStale() is not called
+  advanceClocks(time::milliseconds(100), 10);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(Name("/C")) == nullptr);
+
+  advanceClocks(time::milliseconds(100), 10);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK(ims.find(Name("/A")) == nullptr);
+  BOOST_CHECK(ims.find(Name("/B")) != nullptr);
+
+  advanceClocks(time::milliseconds(100), 40);
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EvictStaleFirst, T, InMemoryStoragesLimited)
+{
+  Scheduler scheduler(io);
+  T ims(2);
+  ims.enableStaleEviction(scheduler, time::seconds(10));
+
+  ims.insert(*makeFreshData("/1", time::seconds(10)));
+  ims.insert(*makeData("/2"));
+  ims.insert(*makeFreshData("/3", time::seconds(10)));
+
+  // the stale Data is evicted instead of the one chosen by the replacement policy
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(Name("/1")) != nullptr);
+  BOOST_CHECK(ims.find(Name("/2")) == nullptr);
+  BOOST_CHECK(ims.find(Name("/3")) != nullptr);
+
+  // without stale Data, the replacement policy applies
+  ims.insert(*makeFreshData("/4", time::seconds(10)));
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(Name("/4")) != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Freshness
 BOOST_AUTO_TEST_SUITE_END() // Common
 BOOST_AUTO_TEST_SUITE_END() // UtilInMemoryStorage
 
@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "util/token-table.hpp"
+
+#include "boost-test.hpp"
+#include "../unit-test-time-fixture.hpp"
+#include "../make-interest-data.hpp"
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+using namespace ndn::tests;
+
+class TokenTableFixture : public UnitTestTimeFixture
+{
+public:
+  TokenTableFixture()
+    : scheduler(io)
+    , table(scheduler, time::seconds(10), 4)
+  {
+  }
+
+public:
+  Scheduler scheduler;
+  TokenTable<int> table;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilTokenTable, TokenTableFixture)
+
+BOOST_AUTO_TEST_CASE(BeadAndData)
+{
+  Bead bead("/A");
+  bead.setToken("token-1");
+  table.insert(bead, 1);
+
+  shared_ptr<Data> data = makeData("/A/B");
+  data->setToken("token-1");
+  BOOST_REQUIRE(table.find(*data) != nullptr);
+  BOOST_CHECK_EQUAL(*table.find(*data), 1);
+
+  // decoded Bead is looked up through the token view of its wire
+  Bead decoded(bead.wireEncode());
+  BOOST_REQUIRE(table.find(decoded) != nullptr);
+  BOOST_CHECK_EQUAL(*table.find(decoded), 1);
+
+  data->setToken("token-2");
+  BOOST_CHECK(table.find(*data) == nullptr);
+
+  table.insert(*data, 2);
+  BOOST_CHECK_EQUAL(table.size(), 2);
+  BOOST_CHECK_EQUAL(*table.find(*data), 2);
+  BOOST_CHECK_EQUAL(*table.find(bead), 1);
+
+  // insert with an existing token replaces the value
+  table.insert(bead, 3);
+  BOOST_CHECK_EQUAL(table.size(), 2);
+  BOOST_CHECK_EQUAL(*table.find(bead), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GrowAndErase)
+{
+  const int N = 1000;
+  for (int i = 0; i < N; ++i) {
+    std::string token = "t" + std::to_string(i);
+    table.insert(reinterpret_cast<const uint8_t*>(token.data()), token.size(), i);
+  }
+  BOOST_CHECK_EQUAL(table.size(), N);
+  BOOST_CHECK_GE(table.capacity(), N);
+
+  for (int i = 0; i < N; i += 2) {
+    std::string token = "t" + std::to_string(i);
+    BOOST_CHECK(table.erase(reinterpret_cast<const uint8_t*>(token.data()), token.size()));
+  }
+  BOOST_CHECK_EQUAL(table.size(), N / 2);
+
+  for (int i = 0; i < N; ++i) {
+    std::string token = "t" + std::to_string(i);
+    int* value = table.find(reinterpret_cast<const uint8_t*>(token.data()), token.size());
+    if (i % 2 == 0) {
+      BOOST_CHECK(value == nullptr);
+    }
+    else {
+      BOOST_REQUIRE(value != nullptr);
+      BOOST_CHECK_EQUAL(*value, i);
+    }
+  }
+
+  table.clear();
+  BOOST_CHECK_EQUAL(table.size(), 0);
+  BOOST_CHECK(table.find(reinterpret_cast<const uint8_t*>("t1"), 2) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Expiration)
+{
+  Bead bead1("/A");
+  bead1.setToken("token-1");
+  Bead bead2("/A");
+  bead2.setToken("token-2");
+
+  table.insert(bead1, 1);
+  table.insert(bead2, 2, time::seconds(30));
+
+  advanceClocks(time::seconds(5));
+  table.removeExpiredEntries();
+  BOOST_CHECK(table.find(bead1) != nullptr);
+  BOOST_CHECK(table.find(bead2) != nullptr);
+
+  advanceClocks(time::seconds(10));
+  table.removeExpiredEntries();
+  BOOST_CHECK(table.find(bead1) == nullptr);
+  BOOST_CHECK(table.find(bead2) != nullptr);
+  BOOST_CHECK_EQUAL(table.size(), 1);
+
+  advanceClocks(time::seconds(20));
+  table.removeExpiredEntries();
+  BOOST_CHECK(table.find(bead2) == nullptr);
+  BOOST_CHECK_EQUAL(table.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PeriodicSweep)
+{
+  // expired entries are reclaimed by the scheduled sweep, without removeExpiredEntries()
+  Bead bead1("/A");
+  bead1.setToken("token-1");
+  Bead bead2("/A");
+  bead2.setToken("token-2");
+
+  table.insert(bead1, 1);
+  table.insert(bead2, 2, time::seconds(30));
+
+  advanceClocks(time::milliseconds(500), 10);
+  BOOST_CHECK_EQUAL(table.size(), 2);
+
+  // the sweep runs every quarter of the default time-to-live
+  advanceClocks(time::milliseconds(500), 20);
+  BOOST_CHECK_EQUAL(table.size(), 1);
+  BOOST_CHECK(table.find(bead2) != nullptr);
+
+  // sweeps continue while the table is not empty
+  advanceClocks(time::milliseconds(500), 40);
+  BOOST_CHECK_EQUAL(table.size(), 0);
+
+  // an insert into the empty table schedules a new sweep
+  table.insert(bead1, 3);
+  BOOST_CHECK_EQUAL(table.size(), 1);
+  advanceClocks(time::milliseconds(500), 30);
+  BOOST_CHECK_EQUAL(table.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace util
+} // namespace ndn